@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// compares decoding tracker output bottles with vBottle::get<AE>() against
+// the in-place forEachAE() used by vArmTracing
+
+#include <yarp/os/all.h>
+#include <iCub/eventdriven/all.h>
+#include <cstdio>
+#include <cstdlib>
+#include "aedecode.h"
+
+using namespace ev;
+
+static void fillBottle(vBottle &bot, int n)
+{
+    yarp::os::Bottle &b = bot;
+    b.clear();
+    b.addString(GaussianAE::tag);
+    yarp::os::Bottle &packed = b.addList();
+
+    GaussianAE v;
+    for(int i = 0; i < n; i++) {
+        v.stamp = i;
+        v.x = rand() % 304;
+        v.y = rand() % 240;
+        v.encode(packed);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const int sizes[] = {1, 10, 100, 1000};
+    const int repeats = 20000;
+
+    std::printf("%8s %14s %14s %8s\n", "events", "get<AE> [us]",
+                "forEachAE [us]", "speedup");
+
+    for(unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+
+        vBottle bot;
+        fillBottle(bot, sizes[s]);
+
+        //get<AE>
+        long checksum1 = 0;
+        double t0 = yarp::os::Time::now();
+        for(int r = 0; r < repeats; r++) {
+            vQueue q = bot.get<AE>();
+            for(vQueue::iterator qi = q.begin(); qi != q.end(); qi++)
+                checksum1 += is_event<AE>(*qi)->x;
+        }
+        double t1 = yarp::os::Time::now();
+
+        //in place
+        long checksum2 = 0;
+        for(int r = 0; r < repeats; r++) {
+            forEachAE(bot, [&checksum2](const AE &v) {
+                checksum2 += v.x;
+            });
+        }
+        double t2 = yarp::os::Time::now();
+
+        if(checksum1 != checksum2)
+            std::printf("decoders disagree (%ld != %ld)\n", checksum1, checksum2);
+
+        double us1 = 1e6 * (t1 - t0) / repeats;
+        double us2 = 1e6 * (t2 - t1) / repeats;
+        std::printf("%8d %14.3f %14.3f %7.1fx\n", sizes[s], us1, us2,
+                    us2 > 0 ? us1 / us2 : 0);
+    }
+
+    return 0;
+}
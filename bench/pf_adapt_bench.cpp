@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// compares a fixed number of particles with KLD-sampling (pfKLDAdapter) on a
+// circle that moves across the sensor, vanishes (only noise events) and then
+// appears somewhere else. for each phase it reports the mean particle count,
+// the mean effective sample size, the time of an update and the tracking
+// error over the second half of the phase
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "pf_filter.h"
+
+//events on a circle of radius r around (cx, cy) plus some noise, or only
+//noise if r is 0
+static void circleEvents(pfRandom &rng, double cx, double cy, double r,
+                         int n, std::vector<pfEvent> &events)
+{
+    events.resize(n);
+    for(int i = 0; i < n; i++) {
+        double a = 2.0 * M_PI * (rng.next() % 3600) / 3600.0;
+        bool noise = r == 0.0 || rng.next() % 10 == 0;
+        double x = noise ? rng.next() % PF_RETINA_WIDTH : cx + r * std::cos(a);
+        double y = noise ? rng.next() % PF_RETINA_HEIGHT : cy + r * std::sin(a);
+        events[i].x = (int16_t)x;
+        events[i].y = (int16_t)y;
+    }
+}
+
+template <typename T>
+static void run(const char *type, unsigned int particles, int steps,
+                unsigned int nmin = 0, unsigned int nmax = 0)
+{
+    pfFullParticleFilter<T> pf(particles, 1);
+    if(nmax) pf.setAdaptive(nmin, nmax);
+    pf.initialise(particles, T(100.0), T(120.0), T(25.0));
+
+    static const char *phases[] = {"tracking", "lost", "reacquire"};
+    pfRandom rng(7);
+    std::vector<pfEvent> events;
+
+    for(int phase = 0; phase < 3; phase++) {
+
+        double count = 0, ess = 0, err = 0;
+        unsigned int updates = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for(int s = 0; s < steps; s++) {
+            double cx = phase == 0 ? 100.0 + 100.0 * s / steps : 220.0;
+            double cy = phase == 0 ? 120.0 : 70.0;
+            double r = phase == 1 ? 0.0 : 25.0;
+            circleEvents(rng, cx, cy, r, 150, events);
+            for(unsigned int i = 0; i < events.size(); i++)
+                pf.addEvent(events[i].x, events[i].y);
+            while(pf.pending()) {
+                pf.step();
+                count += pf.size();
+                ess += pf.effectiveSize();
+                updates++;
+            }
+            if(s >= steps / 2)
+                err += std::hypot((double)pf.x() - cx, (double)pf.y() - cy);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+
+        double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        char name[32];
+        std::snprintf(name, sizeof(name), "%s %s", type, nmax ? "kld" : "fixed");
+        std::printf("%14s %10s %10.0f %8.0f %12.2f %12.2f\n", name,
+                    phases[phase], count / updates, ess / updates,
+                    us / updates, phase == 1 ? 0.0 : err / (steps - steps / 2));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int steps = argc > 1 ? std::atoi(argv[1]) : 300;
+
+    std::printf("%14s %10s %10s %8s %12s %12s\n", "filter", "phase",
+                "particles", "ess", "us/update", "error [px]");
+    run<float>("float", 1000, steps);
+    run<float>("float", 1000, steps, PF_MIN_PARTICLES, PF_MAX_PARTICLES);
+    run<double>("double", 1000, steps);
+    run<double>("double", 1000, steps, PF_MIN_PARTICLES, PF_MAX_PARTICLES);
+    run<pfAccum>("fixed", 1000, steps);
+    run<pfAccum>("fixed", 1000, steps, PF_MIN_PARTICLES, PF_MAX_PARTICLES);
+
+    return 0;
+}
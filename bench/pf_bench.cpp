@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// times the host port of pf_fullparticle for each numeric type on a synthetic
+// circle moving across the sensor, and reports the tracking error. then times
+// the float filter on 1 to all hardware threads
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <thread>
+#include "pf_filter.h"
+
+//events on a circle of radius r around (cx, cy) plus some noise
+static void circleEvents(pfRandom &rng, double cx, double cy, double r,
+                         int n, std::vector<pfEvent> &events)
+{
+    events.resize(n);
+    for(int i = 0; i < n; i++) {
+        double a = 2.0 * M_PI * (rng.next() % 3600) / 3600.0;
+        bool noise = rng.next() % 10 == 0;
+        double x = noise ? rng.next() % PF_RETINA_WIDTH : cx + r * std::cos(a);
+        double y = noise ? rng.next() % PF_RETINA_HEIGHT : cy + r * std::sin(a);
+        events[i].x = (int16_t)x;
+        events[i].y = (int16_t)y;
+    }
+}
+
+template <typename T>
+static void run(const char *type, unsigned int particles, int steps,
+                unsigned int threads = 1, bool polar = false)
+{
+    pfFullParticleFilter<T> pf(particles, 1, threads);
+    pf.setPolar(polar);
+    pf.initialise(particles, T(100.0), T(120.0), T(25.0));
+
+    pfRandom rng(7);
+    std::vector<pfEvent> events;
+    double err = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for(int s = 0; s < steps; s++) {
+        double cx = 100.0 + 100.0 * s / steps;
+        double cy = 120.0;
+        circleEvents(rng, cx, cy, 25.0, 150, events);
+        for(unsigned int i = 0; i < events.size(); i++)
+            pf.addEvent(events[i].x, events[i].y);
+        while(pf.pending())
+            pf.step();
+        if(s >= steps / 2)
+            err += std::hypot((double)pf.x() - cx, (double)pf.y() - cy);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+    std::printf("%8s %10u %8u %12.2f %12.2f\n", type, particles, threads,
+                us / steps, err / (steps - steps / 2));
+}
+
+int main(int argc, char *argv[])
+{
+    int steps = argc > 1 ? std::atoi(argv[1]) : 500;
+    const unsigned int sizes[] = {100, 1000};
+
+    std::printf("%8s %10s %8s %12s %12s\n", "type", "particles", "threads",
+                "us/update", "error [px]");
+    for(unsigned int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        run<float>("float", sizes[i], steps);
+        run<double>("double", sizes[i], steps);
+        run<pfAccum>("fixed", sizes[i], steps);
+        run<float>("float-p", sizes[i], steps, 1, true);
+        run<double>("double-p", sizes[i], steps, 1, true);
+        run<pfAccum>("fixed-p", sizes[i], steps, 1, true);
+    }
+
+    const unsigned int large[] = {1000, 10000};
+    unsigned int cores = std::thread::hardware_concurrency();
+    for(unsigned int i = 0; i < sizeof(large) / sizeof(large[0]); i++)
+        for(unsigned int t = 1; t <= cores; t = t < cores && 2 * t > cores ?
+                                                cores : 2 * t)
+            run<float>("float", large[i], steps, t);
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// times the likelihood of particles against the whole event window and
+// against the events the grid finds near them, for circles of radius 10 to
+// 40 in light to heavy background activity, and checks that both give the
+// same values. "visited" is the share of the window the grid leaves to a
+// particle and "auto" whether PF_GRID_AUTO would use the grid for it
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "pf_filter.h"
+
+//a window of events on a circle of radius r around (150, 120) and, with
+//probability noise, anywhere on the sensor
+static void makeWindow(pfRandom &rng, double r, double noise,
+                       pfEventWindow &window, pfEventGrid &grid)
+{
+    window.clear();
+    grid.clear();
+    for(int i = 0; i < 2 * PF_EVENT_WINDOW_SIZE; i++) {
+        pfEvent e;
+        if(rng.uniform<double>() < noise) {
+            e.x = rng.next() % PF_RETINA_WIDTH;
+            e.y = rng.next() % PF_RETINA_HEIGHT;
+        } else {
+            double a = 2.0 * M_PI * (rng.next() % 3600) / 3600.0;
+            e.x = (int16_t)(150.0 + r * std::cos(a));
+            e.y = (int16_t)(120.0 + r * std::sin(a));
+        }
+        grid.push(window, e);
+    }
+}
+
+template <typename T>
+static void run(const char *type, double radius, double noise, int repeats)
+{
+    const unsigned int np = 200;
+    pfRandom rng(3);
+    pfEventWindow window;
+    pfEventGrid grid;
+    makeWindow(rng, radius, noise, window, grid);
+
+    std::vector<pfParticle<T> > particles(np);
+    for(unsigned int i = 0; i < np; i++) {
+        particles[i].x = T(150.0 + 10.0 * (rng.uniform<double>() - 0.5));
+        particles[i].y = T(120.0 + 10.0 * (rng.uniform<double>() - 0.5));
+        particles[i].r = T(radius + 4.0 * (rng.uniform<double>() - 0.5));
+        particles[i].w = T(1.0);
+    }
+
+    pfWeigher<T> weigh;
+    weigh.load(window);
+
+    //the share of the window the grid visits for the mean particle
+    std::vector<pfEvent> near(PF_EVENT_WINDOW_SIZE);
+    double visited = 0;
+    for(unsigned int i = 0; i < np; i++)
+        visited += grid.near(window, particles[i], near.data());
+    visited /= (double)np * window.size();
+
+    unsigned int mismatches = 0;
+    for(unsigned int i = 0; i < np; i++) {
+        double a = (double)weigh(particles[i], window, 0, 0);
+        double b = (double)weigh(particles[i], window, &grid, 0);
+        if(std::fabs(a - b) > 1e-3 * std::fabs(a)) mismatches++;
+    }
+
+    volatile double sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeats; r++)
+        for(unsigned int i = 0; i < np; i++)
+            sink = sink + (double)weigh(particles[i], window, 0, 0);
+    auto t1 = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeats; r++)
+        for(unsigned int i = 0; i < np; i++)
+            sink = sink + (double)weigh(particles[i], window, &grid, 0);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double n = (double)repeats * np;
+    double tw = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+    double tg = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+    std::printf("%8s %8.0f %8.2f %8.2f %6s %14.1f %14.1f %8.2f %10u\n", type,
+                radius, noise, visited,
+                visited < pfWeigher<T>::gridShare() ? "grid" : "window",
+                tw, tg, tw / tg, mismatches);
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats = argc > 1 ? std::atoi(argv[1]) : 50;
+    const double radii[] = {10.0, 20.0, 40.0};
+    const double noise[] = {0.25, 0.5, 0.75, 0.9};
+
+    std::printf("%8s %8s %8s %8s %6s %14s %14s %8s %10s\n", "type", "radius",
+                "noise", "visited", "auto", "window [ns]", "grid [ns]",
+                "speedup", "mismatches");
+    for(unsigned int j = 0; j < sizeof(noise) / sizeof(noise[0]); j++)
+        for(unsigned int i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+            run<double>("double", radii[i], noise[j], repeats);
+            run<float>("float", radii[i], noise[j], repeats);
+            run<pfAccum>("fixed", radii[i], noise[j], repeats);
+        }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// compares the polar table with LUT_SQRT and approxatan2: the angular error
+// of each against atan2 over every offset of the table, how often their
+// buckets differ, then the time and the difference in likelihood of the two
+// for each numeric type
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "pf_polar.h"
+
+static void accuracy()
+{
+    double approxerr = 0, tableerr = 0;
+    unsigned int differ = 0, entries = 0;
+
+    for(int dy = -PF_POLAR_RANGE; dy <= PF_POLAR_RANGE; dy++) {
+        for(int dx = -PF_POLAR_RANGE; dx <= PF_POLAR_RANGE; dx++) {
+            //the entries at whole pixels
+            if(!dx && !dy) continue;
+            if(dx * dx + dy * dy > PF_MAX_RADIUS_PLUS2_SQRD) continue;
+            entries++;
+
+            double exact = std::atan2((double)dy, (double)dx);
+            double approx = pfApproxAtan2((double)dy, (double)dx);
+            approxerr = std::max(approxerr, std::fabs(approx - exact));
+
+            //the centre of the table's bucket against the exact angle
+            uint32_t e = pf_polar_lut[PF_POLAR_INDEX(dx * PF_POLAR_SUB,
+                                                       dy * PF_POLAR_SUB)];
+            int tb = PF_POLAR_BUCKET(e);
+            int ab = (int)(0.5 + PF_BUCKET_SCALE * (approx + PF_PI));
+            if(tb != ab) differ++;
+            tableerr = std::max(tableerr, std::fabs(std::sqrt((double)(dx * dx + dy * dy)) -
+                                                    pfPolarDistance<double>(e)));
+        }
+    }
+
+    std::printf("approxatan2 max error: %.5f rad (bucket width %.5f rad)\n",
+                approxerr, 1.0 / PF_BUCKET_SCALE);
+    std::printf("buckets differing from approxatan2: %u of %u offsets\n",
+                differ, entries);
+    std::printf("table distance max error: %.6f px\n\n", tableerr);
+}
+
+template <typename T>
+static void run(const char *type, int repeats)
+{
+    const unsigned int np = 200;
+    pfRandom rng(3);
+    pfEventWindow window;
+    for(int i = 0; i < PF_EVENT_WINDOW_SIZE; i++) {
+        pfEvent e;
+        double a = 2.0 * M_PI * (rng.next() % 3600) / 3600.0;
+        e.x = (int16_t)(150.0 + 25.0 * std::cos(a));
+        e.y = (int16_t)(120.0 + 25.0 * std::sin(a));
+        window.add(e);
+    }
+
+    std::vector<T> lutsqrt;
+    pfBuildSqrtTable(lutsqrt);
+    std::vector<pfParticle<T> > particles(np);
+    for(unsigned int i = 0; i < np; i++) {
+        particles[i].x = T(150.0 + 10.0 * (rng.uniform<double>() - 0.5));
+        particles[i].y = T(120.0 + 10.0 * (rng.uniform<double>() - 0.5));
+        particles[i].r = T(25.0 + 6.0 * (rng.uniform<double>() - 0.5));
+        particles[i].w = T(1.0);
+    }
+
+    double diff = 0, maxdiff = 0;
+    for(unsigned int i = 0; i < np; i++) {
+        double a = (double)pfLikelihood(particles[i], window, lutsqrt.data());
+        double b = (double)pfLikelihoodPolar(particles[i], window);
+        diff += std::fabs(a - b) / a;
+        maxdiff = std::max(maxdiff, std::fabs(a - b) / a);
+    }
+
+    volatile double sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeats; r++)
+        for(unsigned int i = 0; i < np; i++)
+            sink = sink + (double)pfLikelihood(particles[i], window,
+                                               lutsqrt.data());
+    auto t1 = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeats; r++)
+        for(unsigned int i = 0; i < np; i++)
+            sink = sink + (double)pfLikelihoodPolar(particles[i], window);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double n = (double)repeats * np * PF_EVENT_WINDOW_SIZE;
+    double ts = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+    double tp = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+    std::printf("%8s %14.2f %14.2f %8.2f %12.4f %12.4f\n", type, ts, tp,
+                ts / tp, diff / np, maxdiff);
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats = argc > 1 ? std::atoi(argv[1]) : 50;
+
+    accuracy();
+
+    std::printf("%8s %14s %14s %8s %12s %12s\n", "type", "sqrt [ns/ev]",
+                "polar [ns/ev]", "speedup", "mean dl/l", "max dl/l");
+    run<double>("double", repeats);
+    run<float>("float", repeats);
+    run<pfAccum>("fixed", repeats);
+
+    return 0;
+}
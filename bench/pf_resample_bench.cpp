@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// times each resampling scheme for 100 to 10000 particles and measures the
+// variance it adds: the mean squared difference between the number of copies
+// of each particle and n w. also checks that the per-draw C version used on
+// SpiNNaker (pf_spinn/common/pf_resample.h) makes the same draws
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "pf_resample.h"
+#include "../pf_spinn/common/pf_resample.h"
+
+static const char *names[] = {"multinomial", "systematic", "stratified",
+                              "residual"};
+
+//skewed weights, like a filter that has found the target
+static void makeWeights(pfRandom &rng, unsigned int n, std::vector<float> &w)
+{
+    w.resize(n);
+    float total = 0;
+    for(unsigned int i = 0; i < n; i++) {
+        float u = rng.uniform<float>();
+        w[i] = u * u * u * u;
+        total += w[i];
+    }
+    for(unsigned int i = 0; i < n; i++)
+        w[i] /= total;
+}
+
+int main(int argc, char *argv[])
+{
+    int trials = argc > 1 ? std::atoi(argv[1]) : 200;
+
+    pfRandom rng(5);
+    std::vector<float> w, uniforms;
+    std::vector<unsigned int> out, copies;
+
+    std::printf("%12s %10s %14s %12s %10s\n", "scheme", "particles",
+                "ns/particle", "variance", "c-mismatch");
+
+    for(unsigned int n = 100; n <= 10000; n *= 10) {
+
+        makeWeights(rng, n, w);
+        out.resize(n);
+        copies.resize(n);
+
+        for(int s = PF_MULTINOMIAL; s <= PF_RESIDUAL; s++) {
+
+            pfResampleScheme scheme = (pfResampleScheme)s;
+            int reps = scheme == PF_MULTINOMIAL ? 1 + trials * 100 / n : trials;
+
+            auto t0 = std::chrono::steady_clock::now();
+            for(int r = 0; r < reps; r++)
+                pfResample(scheme, w.data(), n, n, rng, out.data(), uniforms);
+            auto t1 = std::chrono::steady_clock::now();
+            double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+
+            double var = 0;
+            for(int r = 0; r < reps; r++) {
+                pfResample(scheme, w.data(), n, n, rng, out.data(), uniforms);
+                std::fill(copies.begin(), copies.end(), 0);
+                for(unsigned int i = 0; i < n; i++)
+                    copies[out[i]]++;
+                for(unsigned int i = 0; i < n; i++) {
+                    double d = copies[i] - (double)n * w[i];
+                    var += d * d;
+                }
+            }
+            var /= (double)reps * n;
+
+            //the same draws one at a time
+            unsigned int mismatch = 0;
+            if(scheme != PF_MULTINOMIAL && scheme != PF_STRATIFIED) {
+                pfRandom a(11), b(11);
+                pfResample(scheme, w.data(), n, n, a, out.data(), uniforms);
+                float u = b.uniform<float>();
+                pf_resample_scheme cs = scheme == PF_SYSTEMATIC ?
+                            PF_RESAMPLE_SYSTEMATIC : PF_RESAMPLE_RESIDUAL;
+                for(unsigned int k = 0; k < n; k++)
+                    if(pf_resample_draw(cs, w.data(), NULL, n, k, u) != out[k])
+                        mismatch++;
+            }
+
+            std::printf("%12s %10u %14.2f %12.4f %10u\n", names[s], n,
+                        ns / reps / n, var, mismatch);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// times the vector likelihood kernel against the scalar reference for event
+// windows of 256 to 4096 events, and checks that both give the same values
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "pf_simd.h"
+
+//a circle of radius 25 around (150, 120) in uniform noise
+static void makeEvents(pfRandom &rng, unsigned int n, std::vector<pfEvent> &events)
+{
+    events.resize(n);
+    for(unsigned int i = 0; i < n; i++) {
+        if(rng.next() % 4 == 0) {
+            events[i].x = rng.next() % PF_RETINA_WIDTH;
+            events[i].y = rng.next() % PF_RETINA_HEIGHT;
+        } else {
+            double a = 2.0 * M_PI * (rng.next() % 3600) / 3600.0;
+            events[i].x = (int16_t)(150.0 + 25.0 * std::cos(a));
+            events[i].y = (int16_t)(120.0 + 25.0 * std::sin(a));
+        }
+    }
+}
+
+//particles scattered around the circle
+static void makeParticles(pfRandom &rng, unsigned int n,
+                          std::vector<pfParticle<float> > &particles)
+{
+    particles.resize(n);
+    for(unsigned int i = 0; i < n; i++) {
+        particles[i].x = 150.0f + 20.0f * (rng.uniform<float>() - 0.5f);
+        particles[i].y = 120.0f + 20.0f * (rng.uniform<float>() - 0.5f);
+        particles[i].r = 25.0f + 10.0f * (rng.uniform<float>() - 0.5f);
+        particles[i].w = 1.0f;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int repeats = argc > 1 ? std::atoi(argv[1]) : 20;
+    const unsigned int np = 100;
+
+    pfRandom rng(3);
+    std::vector<float> lutsqrt;
+    pfBuildSqrtTable(lutsqrt);
+    pfLikelihoodKernel kernel;
+    std::vector<pfParticle<float> > particles;
+    makeParticles(rng, np, particles);
+
+    std::printf("kernel: %s\n", PF_SIMD_NAME);
+    std::printf("%8s %14s %14s %8s %10s\n", "events", "scalar [ns/ev]",
+                "simd [ns/ev]", "speedup", "mismatches");
+
+    for(unsigned int n = 256; n <= 4096; n *= 2) {
+
+        std::vector<pfEvent> raw;
+        makeEvents(rng, n, raw);
+        pfEventArrays events;
+        events.load(raw.data(), n);
+
+        unsigned int mismatches = 0;
+        for(unsigned int i = 0; i < np; i++) {
+            float a = pfLikelihoodScalar(particles[i], events, lutsqrt.data());
+            float b = kernel(particles[i], events);
+            if(std::fabs(a - b) > 1e-3f * std::fabs(a)) mismatches++;
+        }
+
+        volatile float sink = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for(int r = 0; r < repeats; r++)
+            for(unsigned int i = 0; i < np; i++)
+                sink = sink + pfLikelihoodScalar(particles[i], events,
+                                                 lutsqrt.data());
+        auto t1 = std::chrono::steady_clock::now();
+        for(int r = 0; r < repeats; r++)
+            for(unsigned int i = 0; i < np; i++)
+                sink = sink + kernel(particles[i], events);
+        auto t2 = std::chrono::steady_clock::now();
+
+        double evs = (double)repeats * np * n;
+        double ts = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        double tv = std::chrono::duration<double, std::nano>(t2 - t1).count();
+        std::printf("%8u %14.3f %14.3f %8.2f %10u\n", n, ts / evs, tv / evs,
+                    ts / tv, mismatches);
+    }
+
+    return 0;
+}
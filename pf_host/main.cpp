@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+// runs the SpiNNaker full-particle circle tracker on the host: events are read
+// from <name>/vBottle:i and the target is written to <name>/vBottle:o as an
+// AE at the tracked centre (readable by vArmTracing)
+
+#include <yarp/os/all.h>
+#include <iCub/eventdriven/all.h>
+#include <atomic>
+#include "aedecode.h"
+#include "lockfree.h"
+#include "pf_filter.h"
+#include "pf_resample.h"
+
+/*//////////////////////////////////////////////////////////////////////////////
+  FILTER OF ANY NUMERIC TYPE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+class vPFRunner
+{
+public:
+
+    virtual ~vPFRunner() {}
+
+    virtual void addEvent(int x, int y) = 0;
+    virtual unsigned int pending() const = 0;
+    virtual unsigned int dropped() const = 0;
+    virtual void step() = 0;
+    virtual void setResampling(pfResampleScheme scheme) = 0;
+    virtual void setGrid(pfGridMode mode) = 0;
+    virtual void setAdaptive(unsigned int nmin, unsigned int nmax) = 0;
+    virtual unsigned int size() const = 0;
+    virtual double effectiveSize() const = 0;
+    virtual void target(double &x, double &y, double &r) const = 0;
+
+};
+
+template <typename T>
+class vPFTypedRunner : public vPFRunner
+{
+private:
+
+    pfFullParticleFilter<T> pf;
+
+public:
+
+    vPFTypedRunner(unsigned int n, uint32_t seed, unsigned int threads) :
+        pf(n, seed, threads) {}
+
+    void addEvent(int x, int y) { pf.addEvent(x, y); }
+    unsigned int pending() const { return pf.pending(); }
+    unsigned int dropped() const { return pf.dropped(); }
+    void step() { pf.step(); }
+    void setResampling(pfResampleScheme scheme) { pf.setResampling(scheme); }
+    void setGrid(pfGridMode mode) { pf.setGrid(mode); }
+    void setAdaptive(unsigned int nmin, unsigned int nmax)
+    {
+        pf.setAdaptive(nmin, nmax);
+    }
+    unsigned int size() const { return pf.size(); }
+    double effectiveSize() const { return pf.effectiveSize(); }
+    void target(double &x, double &y, double &r) const
+    {
+        x = (double)pf.x();
+        y = (double)pf.y();
+        r = (double)pf.r();
+    }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  VBOTTLE READER/PROCESSOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+class vPFTrackerPort : public yarp::os::BufferedPort<ev::vBottle>
+{
+private:
+
+    vPFRunner *pf;
+    yarp::os::BufferedPort<ev::vBottle> outport;
+
+    std::atomic<unsigned int> events;
+    std::atomic<unsigned int> steps;
+    std::atomic<double> steptime;
+
+    //target x y r, particles, effective size and dropped events after the
+    //last step, written by onRead for printStatus
+    vSeqlock<6> snapshot;
+
+public:
+
+    vPFTrackerPort() : pf(0), events(0), steps(0), steptime(0) {}
+    ~vPFTrackerPort() { delete pf; }
+
+    //builds the filter. it is configured (setGrid, setAdaptive) before open()
+    //starts the callback that steps it
+    bool create(const std::string &type, unsigned int n, uint32_t seed,
+                unsigned int threads, const std::string &resampling)
+    {
+        pfResampleScheme scheme;
+        if(!pfResampleSchemeFromName(resampling, scheme)) {
+            yError() << "Unknown resampling" << resampling
+                     << "(systematic | stratified | residual | multinomial)";
+            return false;
+        }
+
+        if(type == "float")
+            pf = new vPFTypedRunner<float>(n, seed, threads);
+        else if(type == "double")
+            pf = new vPFTypedRunner<double>(n, seed, threads);
+        else if(type == "fixed")
+            pf = new vPFTypedRunner<pfAccum>(n, seed, threads);
+        else {
+            yError() << "Unknown type" << type << "(float | double | fixed)";
+            return false;
+        }
+        pf->setResampling(scheme);
+        yInfo() << "Tracking with" << n << type << "particles on" << threads
+                 << "threads," << resampling << "resampling";
+        return true;
+    }
+
+    //the input port is opened last: from then on onRead steps the filter
+    bool open(const std::string &name)
+    {
+        if(!outport.open(name + "/vBottle:o"))
+            return false;
+        this->useCallback();
+        return yarp::os::BufferedPort<ev::vBottle>::open(name + "/vBottle:i");
+    }
+
+    //on | off | auto. by default (auto) the grid is used in the steps where
+    //it is faster
+    bool setGrid(const std::string &grid)
+    {
+        if(grid == "on")
+            pf->setGrid(PF_GRID_ON);
+        else if(grid == "off")
+            pf->setGrid(PF_GRID_OFF);
+        else if(grid == "auto")
+            pf->setGrid(PF_GRID_AUTO);
+        else {
+            yError() << "Unknown event grid mode" << grid << "(on | off | auto)";
+            return false;
+        }
+        yInfo() << "Event grid" << grid;
+        return true;
+    }
+
+    //KLD-sampling between nmin and nmax particles
+    void setAdaptive(unsigned int nmin, unsigned int nmax)
+    {
+        pf->setAdaptive(nmin, nmax);
+        yInfo() << "Adapting the particles between" << nmin << "and" << nmax;
+    }
+
+    void close()
+    {
+        yarp::os::BufferedPort<ev::vBottle>::close();
+        outport.close();
+    }
+
+    void interrupt()
+    {
+        yarp::os::BufferedPort<ev::vBottle>::interrupt();
+        outport.interrupt();
+    }
+
+    void onRead(ev::vBottle &bot)
+    {
+        yarp::os::Stamp st;
+        this->getEnvelope(st);
+
+        events += forEachAE(bot, [this](const ev::AE &v) {
+            pf->addEvent(v.x, v.y);
+        });
+
+        //every step takes at most 2 pi r events from the queue
+        double t0 = yarp::os::Time::now();
+        unsigned int n = 0;
+        while(pf->pending()) {
+            pf->step();
+            n++;
+        }
+        if(!n) return;
+        steptime = steptime + yarp::os::Time::now() - t0;
+        steps += n;
+
+        double d[6];
+        pf->target(d[0], d[1], d[2]);
+        d[3] = pf->size();
+        d[4] = pf->effectiveSize();
+        d[5] = pf->dropped();
+        snapshot.write(d);
+
+        auto ae = ev::make_event<ev::AE>();
+        ae->x = (int)(d[0] + 0.5);
+        ae->y = (int)(d[1] + 0.5);
+        ae->stamp = 0;
+
+        ev::vBottle &out = outport.prepare();
+        out.clear();
+        out.addEvent(ae);
+        outport.setEnvelope(st);
+        outport.write();
+    }
+
+    void printStatus(double period)
+    {
+        unsigned int s = steps.exchange(0);
+        unsigned int e = events.exchange(0);
+        double t = steptime.exchange(0);
+
+        //only the snapshot: the filter belongs to the callback thread
+        double d[6];
+        snapshot.read(d);
+        yInfo() << s / period << "steps/s |" << (s ? 1e6 * t / s : 0)
+                << "us/step |" << e / period << "events/s |"
+                << (unsigned int)d[5] << "dropped |" << (unsigned int)d[3]
+                << "particles |" << d[4] << "effective | target [" << d[0]
+                << d[1] << d[2] << "]";
+    }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  MODULE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+class vPFTrackerModule : public yarp::os::RFModule
+{
+private:
+
+    vPFTrackerPort tracker;
+    double printperiod;
+
+public:
+
+    bool configure(yarp::os::ResourceFinder &rf)
+    {
+        std::string name = rf.check("name",
+                                    yarp::os::Value("/vPFTracker")).asString();
+        printperiod = rf.check("printperiod", yarp::os::Value(1.0)).asDouble();
+
+        if(!tracker.create(rf.check("type", yarp::os::Value("float")).asString(),
+                           rf.check("particles",
+                                    yarp::os::Value(PF_PARTICLES)).asInt(),
+                           rf.check("seed", yarp::os::Value(1)).asInt(),
+                           rf.check("threads", yarp::os::Value(1)).asInt(),
+                           rf.check("resampling",
+                                    yarp::os::Value("systematic")).asString()))
+            return false;
+
+        if(rf.check("grid") && !tracker.setGrid(rf.find("grid").asString()))
+            return false;
+
+        if(rf.check("adaptive") || rf.check("minparticles") ||
+           rf.check("maxparticles"))
+            tracker.setAdaptive(rf.check("minparticles",
+                                         yarp::os::Value(PF_MIN_PARTICLES)).asInt(),
+                                rf.check("maxparticles",
+                                         yarp::os::Value(PF_MAX_PARTICLES)).asInt());
+
+        //last, as onRead steps the filter from here on
+        return tracker.open(name);
+    }
+
+    bool interruptModule()
+    {
+        tracker.interrupt();
+        return yarp::os::RFModule::interruptModule();
+    }
+
+    bool close()
+    {
+        tracker.close();
+        return yarp::os::RFModule::close();
+    }
+
+    double getPeriod()
+    {
+        return printperiod;
+    }
+
+    bool updateModule()
+    {
+        tracker.printStatus(printperiod);
+        return true;
+    }
+
+};
+
+int main(int argc, char * argv[])
+{
+    yarp::os::Network yarp;
+    if(!yarp.checkNetwork()) {
+        yError() << "YARP doesn't seem to be available";
+        return 1;
+    }
+
+    yarp::os::ResourceFinder rf;
+    rf.setDefaultContext("eventdriven");
+    rf.setDefaultConfigFile("pftracker.ini");
+    rf.configure(argc, argv);
+
+    vPFTrackerModule module;
+    return module.runModule(rf);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_ADAPT__
+#define __PF_HOST_ADAPT__
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "pf_fullparticle.h"
+
+#define PF_KLD_BIN_XY           4       // [px]
+#define PF_KLD_BIN_R            2       // [px]
+#define PF_KLD_EPSILON          0.05    //bound on the KL divergence
+#define PF_KLD_Z                2.326   //upper 0.01 quantile of N(0, 1)
+#define PF_MIN_PARTICLES        50
+#define PF_MAX_PARTICLES        2000
+
+#define PF_KLD_COLUMNS          ((PF_RETINA_WIDTH + PF_KLD_BIN_XY - 1) / PF_KLD_BIN_XY)
+#define PF_KLD_ROWS             ((PF_RETINA_HEIGHT + PF_KLD_BIN_XY - 1) / PF_KLD_BIN_XY)
+#define PF_KLD_RADII            ((int)(PF_MAX_RADIUS - PF_MIN_RADIUS) / PF_KLD_BIN_R + 1)
+
+/*//////////////////////////////////////////////////////////////////////////////
+  EFFECTIVE SAMPLE SIZE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//1 / sum(w^2) of normalised weights (pf_agg.c keeps sum(w^2) as sumsqr). in
+//double, as the squares of s16.15 weights round to 0
+template <typename T>
+inline double pfEffectiveSampleSize(const T *w, unsigned int n)
+{
+    double sumsqr = 0.0;
+    for(unsigned int i = 0; i < n; i++)
+        sumsqr += (double)w[i] * (double)w[i];
+    return sumsqr > 0.0 ? 1.0 / sumsqr : 0.0;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  KLD SAMPLING
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the number of particles for the next step from how spread out the resampled
+//particles are (Fox, KLD-sampling): the particles fall into k bins of
+//PF_KLD_BIN_XY x PF_KLD_BIN_XY x PF_KLD_BIN_R, and n particles keep the KL
+//divergence of the sampled posterior within epsilon with probability
+//1 - delta (z its quantile) when n = (k - 1) / 2 epsilon (1 - a + sqrt(a) z)^3
+//with a = 2 / 9 (k - 1). a tight posterior needs few particles; a lost target,
+//whose particles wander over the sensor, needs many. n is kept in [min, max].
+//a bin is occupied if its stamp is the current count, so nothing is cleared
+//between counts
+class pfKLDAdapter
+{
+private:
+
+    std::vector<uint32_t> stamp;
+    uint32_t count;
+    unsigned int nmin;
+    unsigned int nmax;
+    double epsilon;
+    double z;
+
+    static int clamp(int i, int n) { return i < 0 ? 0 : (i >= n ? n - 1 : i); }
+
+public:
+
+    pfKLDAdapter() : count(0), nmin(PF_MIN_PARTICLES), nmax(PF_MAX_PARTICLES),
+        epsilon(PF_KLD_EPSILON), z(PF_KLD_Z) {}
+
+    void configure(unsigned int nmin, unsigned int nmax,
+                   double epsilon = PF_KLD_EPSILON, double z = PF_KLD_Z)
+    {
+        if(nmin < 1) nmin = 1;
+        if(nmax < nmin) nmax = nmin;
+        this->nmin = nmin;
+        this->nmax = nmax;
+        this->epsilon = epsilon;
+        this->z = z;
+        stamp.assign(PF_KLD_COLUMNS * PF_KLD_ROWS * PF_KLD_RADII, 0);
+        count = 0;
+    }
+
+    unsigned int minimum() const { return nmin; }
+    unsigned int maximum() const { return nmax; }
+
+    //the particles for k occupied bins, within [min, max]
+    unsigned int size(unsigned int k) const
+    {
+        if(k < 2) return nmin;
+        double a = 2.0 / (9.0 * (k - 1));
+        double b = 1.0 - a + std::sqrt(a) * z;
+        double n = std::ceil((k - 1) / (2.0 * epsilon) * b * b * b);
+        if(n < nmin) return nmin;
+        if(n > nmax) return nmax;
+        return (unsigned int)n;
+    }
+
+    //the number of bins occupied by the particles of p
+    template <typename T>
+    unsigned int bins(const pfParticleStore<T> &p)
+    {
+        if(++count == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            count = 1;
+        }
+
+        const T *x = p.x(), *y = p.y(), *r = p.r();
+        unsigned int k = 0;
+        for(unsigned int i = 0; i < p.size(); i++) {
+            int bx = clamp((int)x[i] / PF_KLD_BIN_XY, PF_KLD_COLUMNS);
+            int by = clamp((int)y[i] / PF_KLD_BIN_XY, PF_KLD_ROWS);
+            int br = clamp(((int)r[i] - (int)PF_MIN_RADIUS) / PF_KLD_BIN_R,
+                           PF_KLD_RADII);
+            uint32_t &s = stamp[(br * PF_KLD_ROWS + by) * PF_KLD_COLUMNS + bx];
+            if(s != count) {
+                s = count;
+                k++;
+            }
+        }
+        return k;
+    }
+
+    template <typename T>
+    unsigned int size(const pfParticleStore<T> &p) { return size(bins(p)); }
+
+};
+
+#endif
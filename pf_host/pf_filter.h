@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_FILTER__
+#define __PF_HOST_FILTER__
+
+#include <vector>
+#include "pf_fullparticle.h"
+#include "pf_simd.h"
+#include "pf_pool.h"
+#include "pf_resample.h"
+#include "pf_grid.h"
+#include "pf_polar.h"
+#include "pf_adapt.h"
+
+#define PF_BATCH_SIZE           64      //particles weighed as one job
+
+/*//////////////////////////////////////////////////////////////////////////////
+  LIKELIHOOD OF ANY NUMERIC TYPE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//weighs particles against the whole window with pfLikelihood (or
+//pfLikelihoodPolar) or, given a grid, against the events near the particle.
+//each worker has its own space for the near events
+template <typename T>
+class pfWeigher
+{
+private:
+
+    std::vector<T> lutsqrt;
+    std::vector<pfEvent> near;
+    bool polar;
+
+public:
+
+    //whether the polar table makes this weigher faster
+    static const bool preferspolar = true;
+
+    //the grid is faster while the share of the window it visits is below
+    //this (bench/pf_grid_bench)
+    static double gridShare();
+
+    pfWeigher() : near(PF_EVENT_WINDOW_SIZE), polar(preferspolar)
+    {
+        pfBuildSqrtTable(lutsqrt);
+    }
+
+    void setWorkers(unsigned int n) { near.resize(n * PF_EVENT_WINDOW_SIZE); }
+    void setPolar(bool on) { polar = on; }
+
+    //called once a step, after the window changes
+    void load(const pfEventWindow &window) { (void)window; }
+
+    T operator()(const pfParticle<T> &p, const pfEventWindow &window,
+                 const pfEventGrid *grid, unsigned int worker)
+    {
+        if(!grid)
+            return polar ? pfLikelihoodPolar(p, window) :
+                           pfLikelihood(p, window, lutsqrt.data());
+
+        pfEvent *events = &near[worker * PF_EVENT_WINDOW_SIZE];
+        unsigned int n = grid->near(window, p, events);
+        return polar ? pfLikelihoodPolar(p, events, n) :
+                       pfLikelihood(p, events, n, lutsqrt.data());
+    }
+
+};
+
+//double pays the grid back from about half the window down; fixed point,
+//whose polar loop is cheaper, only once the grid leaves a fifth of it
+template <typename T>
+inline double pfWeigher<T>::gridShare() { return 0.5; }
+
+template <>
+inline double pfWeigher<pfAccum>::gridShare() { return 0.2; }
+
+//float particles use the vector kernel on a flat copy of the window (or of
+//the near events). the kernel keeps scratch space, so each worker has its
+//own. the kernel rejects far events about as fast as the grid finds the near
+//ones, so the grid is never faster. the polar table is used by the scalar
+//loop, which is slower than the kernel, so it is off by default
+template <>
+class pfWeigher<float>
+{
+private:
+
+    pfEventArrays events;
+    std::vector<pfLikelihoodKernel> kernels;
+    std::vector<pfEventArrays> nearevents;
+    std::vector<pfEvent> near;
+    bool polar;
+
+public:
+
+    static const bool preferspolar = false;
+    static double gridShare() { return 0.0; }
+
+    pfWeigher() : polar(preferspolar)
+    {
+        setWorkers(1);
+        events.reserve(PF_EVENT_WINDOW_SIZE);
+    }
+
+    void setWorkers(unsigned int n)
+    {
+        kernels.resize(n);
+        nearevents.resize(n);
+        for(unsigned int i = 0; i < n; i++)
+            nearevents[i].reserve(PF_EVENT_WINDOW_SIZE);
+        near.resize(n * PF_EVENT_WINDOW_SIZE);
+    }
+
+    void setPolar(bool on) { polar = on; }
+
+    void load(const pfEventWindow &window) { if(!polar) events.load(window); }
+
+    float operator()(const pfParticle<float> &p, const pfEventWindow &window,
+                     const pfEventGrid *grid, unsigned int worker)
+    {
+        if(!grid)
+            return polar ? pfLikelihoodPolar(p, window) :
+                           kernels[worker](p, events);
+
+        pfEvent *e = &near[worker * PF_EVENT_WINDOW_SIZE];
+        unsigned int n = grid->near(window, p, e);
+        if(polar)
+            return pfLikelihoodPolar(p, e, n);
+        nearevents[worker].load(e, n);
+        return kernels[worker](p, nearevents[worker]);
+    }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  FILTER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//PF_GRID_AUTO weighs against the grid in the steps where it is faster
+enum pfGridMode { PF_GRID_OFF, PF_GRID_ON, PF_GRID_AUTO };
+
+//all particles of the SpiNNaker graph on the host. one step() is one update
+//of every particle core: normalise, resample, predict and weigh. unlike the
+//hardware, where each core fills its own window, the particles share one
+//window that takes up to 2 pi r (of the target) new events a step.
+//normalise and resample run on the calling thread; predict and weigh run on
+//a pool of workers in batches of PF_BATCH_SIZE particles. each batch has its
+//own random generator, so the result does not depend on the thread count
+template <typename T>
+class pfFullParticleFilter
+{
+private:
+
+    pfParticleStore<T> particles;
+    pfWeigher<T> weigh;
+    pfEventWindow window;
+    pfEventGrid grid;
+    pfGridMode gridmode;
+    bool usegrid;
+    pfEventQueue queue;
+    pfRandom rng;
+    pfResampleScheme scheme;
+    std::vector<unsigned int> draws;
+    std::vector<T> uniforms;
+    std::vector<pfRandom> batchrng;
+    pfWorkPool pool;
+    pfKLDAdapter adapt;
+    bool adaptive;
+    unsigned int nnext;
+    double ess;
+    T target[3];
+    T sigma;
+
+    //room for n particles in everything sized by the particle count, so that
+    //the count can change up to n without allocating
+    void reserve(unsigned int n)
+    {
+        particles.reserve(n);
+        n = particles.capacity();
+        draws.resize(n);
+        uniforms.reserve(n);
+        unsigned int batches = (n + PF_BATCH_SIZE - 1) / PF_BATCH_SIZE;
+        for(unsigned int i = batchrng.size(); i < batches; i++)
+            batchrng.push_back(pfRandom(rng.next()));
+    }
+
+    void weighBatch(unsigned int batch, unsigned int worker)
+    {
+        unsigned int i = batch * PF_BATCH_SIZE;
+        unsigned int end = i + PF_BATCH_SIZE;
+        if(end > particles.size()) end = particles.size();
+
+        for(; i < end; i++) {
+            pfParticle<T> p = particles.get(i);
+            pfPredict(p, sigma, batchrng[batch]);
+            p.w = p.w * weigh(p, window, usegrid ? &grid : 0, worker) *
+                    T(PF_INV_ANG_BUCKETS);
+            particles.set(i, p);
+        }
+    }
+
+public:
+
+    pfFullParticleFilter(unsigned int n = PF_PARTICLES, uint32_t seed = 1,
+                         unsigned int threads = 1) :
+        gridmode(PF_GRID_AUTO), usegrid(false), rng(seed), scheme(PF_SYSTEMATIC),
+        pool(threads),
+        adaptive(false), nnext(n), ess(n), sigma(PF_SIGMA)
+    {
+        weigh.setWorkers(pool.workers());
+        initialise(n, T(PF_RETINA_WIDTH / 2), T(PF_RETINA_HEIGHT / 2),
+                   T(PF_INITIAL_R));
+    }
+
+    void initialise(unsigned int n, T x, T y, T r)
+    {
+        pfParticle<T> p = {x, y, r, T(1.0)};
+        reserve(n);
+        particles.resize(n);
+        for(unsigned int i = 0; i < n; i++)
+            particles.set(i, p);
+        target[0] = x; target[1] = y; target[2] = r;
+        nnext = n;
+        ess = n;
+        window.clear();
+        grid.clear();
+
+        for(unsigned int i = 0; i < batchrng.size(); i++)
+            batchrng[i].seed(rng.next());
+    }
+
+    void setSigma(T sigma) { this->sigma = sigma; }
+    void setResampling(pfResampleScheme scheme) { this->scheme = scheme; }
+
+    //resample to as many particles, in [nmin, nmax], as KLD-sampling asks of
+    //the spread of the last resampled set (pfKLDAdapter). everything is
+    //allocated for nmax here
+    void setAdaptive(unsigned int nmin, unsigned int nmax,
+                     double epsilon = PF_KLD_EPSILON, double z = PF_KLD_Z)
+    {
+        adapt.configure(nmin, nmax, epsilon, z);
+        reserve(adapt.maximum());
+        adaptive = true;
+        nnext = particles.size();
+        if(nnext < adapt.minimum()) nnext = adapt.minimum();
+        if(nnext > adapt.maximum()) nnext = adapt.maximum();
+    }
+
+    //read the distance and angle of each event from the polar table (by
+    //default if it is faster for T). the particle centre is rounded to a pixel
+    void setPolar(bool on) { weigh.setPolar(on); }
+
+    //weigh each particle against only the events near it: always, never or
+    //(by default) in the steps where the events near the target are a small
+    //enough share of the window (pfWeigher::gridShare). the grid is rebuilt
+    //from the window if it was not kept up while off
+    void setGrid(pfGridMode mode)
+    {
+        bool kept = gridKept();
+        gridmode = mode;
+        if(kept || !gridKept()) return;
+
+        grid.clear();
+        for(unsigned int i = 0; i < window.size(); i++) {
+            unsigned int slot = (window.newest() + PF_EVENT_WINDOW_SIZE - i) %
+                    PF_EVENT_WINDOW_SIZE;
+            grid.add(slot, window.at(slot));
+        }
+    }
+
+    //whether the grid follows the window
+    bool gridKept() const
+    {
+        return gridmode == PF_GRID_ON ||
+               (gridmode == PF_GRID_AUTO && pfWeigher<T>::gridShare() > 0.0);
+    }
+
+    //whether the last step weighed against the grid
+    bool gridUsed() const { return usegrid; }
+
+    //returns false (and counts a drop) if the input buffer is full
+    bool addEvent(int x, int y)
+    {
+        pfEvent e;
+        e.x = x;
+        e.y = y;
+        return queue.push(e);
+    }
+
+    unsigned int pending() const { return queue.size(); }
+    unsigned int dropped() const { return queue.dropped; }
+    unsigned int size() const { return particles.size(); }
+    unsigned int threads() const { return pool.workers(); }
+    bool isAdaptive() const { return adaptive; }
+
+    //the effective sample size of the weights normalised at the start of
+    //the last step
+    double effectiveSize() const { return ess; }
+    const pfParticleStore<T> &states() const { return particles; }
+    const pfEventWindow &events() const { return window; }
+
+    //the weighted mean [x y r] computed at the start of the last step
+    T x() const { return target[0]; }
+    T y() const { return target[1]; }
+    T r() const { return target[2]; }
+
+    //moves new events into the window. returns the number moved
+    unsigned int loadWindow()
+    {
+        unsigned int batch = (unsigned int)(int)(T(2.0 * PF_PI) * target[2] +
+                                                 T(0.5));
+        if(batch > PF_EVENT_WINDOW_SIZE) batch = PF_EVENT_WINDOW_SIZE;
+
+        bool kept = gridKept();
+        pfEvent e;
+        unsigned int i;
+        for(i = 0; i < batch && queue.pop(e); i++) {
+            if(kept)
+                grid.push(window, e);
+            else
+                window.add(e);
+        }
+
+        return i;
+    }
+
+    //whether to weigh this step against the grid
+    bool chooseGrid() const
+    {
+        if(gridmode != PF_GRID_AUTO) return gridmode == PF_GRID_ON;
+        if(!gridKept() || !window.size()) return false;
+
+        pfParticle<T> p = {target[0], target[1], target[2], T(1.0)};
+        return grid.count(p) < pfWeigher<T>::gridShare() * window.size();
+    }
+
+    void step()
+    {
+        unsigned int n = particles.size();
+
+        pfNormalise(particles, target);
+        ess = pfEffectiveSampleSize(particles.w(), n);
+
+        unsigned int m = adaptive ? nnext : n;
+        pfResample(scheme, particles.w(), n, m, rng, draws.data(), uniforms);
+        for(unsigned int i = 0; i < m; i++)
+            particles.copyToSpare(i, draws[i]);
+        particles.swap(m);
+        if(adaptive) nnext = adapt.size(particles);
+
+        loadWindow();
+        usegrid = chooseGrid();
+        if(!usegrid) weigh.load(window);
+
+        unsigned int batches = (m + PF_BATCH_SIZE - 1) / PF_BATCH_SIZE;
+        pool.run(batches, [this](unsigned int batch, unsigned int worker) {
+            weighBatch(batch, worker);
+        });
+    }
+
+};
+
+#endif
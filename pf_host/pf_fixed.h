@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_FIXED__
+#define __PF_HOST_FIXED__
+
+#include <stdint.h>
+#include <cmath>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ACCUM
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//host stand-in for the ISO/IEC TR 18037 (stdfix) accum used on SpiNNaker: a
+//signed 32 bit s16.15 fixed point number. arithmetic wraps like the ARM
+//build (no saturation), products and quotients are truncated and constants
+//are rounded to the nearest step like the k-suffixed literals
+class pfAccum
+{
+public:
+
+    static const int FRAC_BITS = 15;
+    static const int32_t ONE = 1 << FRAC_BITS;
+
+private:
+
+    int32_t v;
+
+public:
+
+    pfAccum() : v(0) {}
+    explicit pfAccum(double d) : v((int32_t)std::floor(d * ONE + 0.5)) {}
+    explicit pfAccum(int i) : v((int32_t)((uint32_t)i << FRAC_BITS)) {}
+
+    //the bit pattern (int_to_accum / accum_to_int in pf_fullparticle.c)
+    static pfAccum fromBits(int32_t bits) { pfAccum a; a.v = bits; return a; }
+    int32_t bits() const { return v; }
+
+    explicit operator double() const { return (double)v / ONE; }
+    explicit operator float() const { return (float)v / ONE; }
+
+    //truncation towards zero, as (int)accum
+    explicit operator int() const { return v >= 0 ? v >> FRAC_BITS :
+                                                    -((-v) >> FRAC_BITS); }
+
+    pfAccum operator-() const { return fromBits(-v); }
+    pfAccum operator+(pfAccum b) const { return fromBits(v + b.v); }
+    pfAccum operator-(pfAccum b) const { return fromBits(v - b.v); }
+    pfAccum operator*(pfAccum b) const
+    {
+        return fromBits((int32_t)(((int64_t)v * b.v) >> FRAC_BITS));
+    }
+    pfAccum operator/(pfAccum b) const
+    {
+        return fromBits((int32_t)(((int64_t)v << FRAC_BITS) / b.v));
+    }
+
+    pfAccum &operator+=(pfAccum b) { v += b.v; return *this; }
+    pfAccum &operator-=(pfAccum b) { v -= b.v; return *this; }
+    pfAccum &operator*=(pfAccum b) { return *this = *this * b; }
+
+    bool operator<(pfAccum b) const { return v < b.v; }
+    bool operator>(pfAccum b) const { return v > b.v; }
+    bool operator<=(pfAccum b) const { return v <= b.v; }
+    bool operator>=(pfAccum b) const { return v >= b.v; }
+    bool operator==(pfAccum b) const { return v == b.v; }
+    bool operator!=(pfAccum b) const { return v != b.v; }
+
+};
+
+#endif
@@ -0,0 +1,404 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_FULLPARTICLE__
+#define __PF_HOST_FULLPARTICLE__
+
+#include <stdint.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "pf_fixed.h"
+
+//the algorithm constants of pf_spinn/pf_fullparticle/pf_fullparticle.c
+#define PF_ANG_BUCKETS          64
+#define PF_INV_ANG_BUCKETS      0.015625
+#define PF_INLIER_PAR_PLUS1     2.0
+#define PF_INV_INLIER_PAR       1.0
+#define PF_MIN_LIKE             12.8    //64 * 0.2
+#define PF_NEG_BIAS_CONSTANT    40.74   //2.0 * 64 / pi r^2
+#define PF_SIGMA                2.0
+#define PF_EVENT_WINDOW_SIZE    256
+#define PF_RETINA_BUFFER_SIZE   4096
+#define PF_MAX_RADIUS           40.0
+#define PF_MIN_RADIUS           10.0
+#define PF_MAX_RADIUS_PLUS2     42
+#define PF_MAX_RADIUS_PLUS2_SQRD 1764
+#define PF_RETINA_WIDTH         304
+#define PF_RETINA_HEIGHT        240
+#define PF_PI                   3.14159265359
+#define PF_PI_4                 0.78539816
+#define PF_BUCKET_SCALE         10.026769884 //ANG_BUCKETS / 2 pi
+#define PF_PARTICLES            100
+#define PF_INITIAL_R            20
+
+/*//////////////////////////////////////////////////////////////////////////////
+  PARTICLE AND EVENTS
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the state of one particle (one core on SpiNNaker)
+template <typename T>
+struct pfParticle {
+    T x;
+    T y;
+    T r;
+    T w;
+};
+
+//the states of n particles as flat arrays in one block, x[0..n) y[0..n)
+//r[0..n) w[0..n) (pf_spinn/common/pf_store.h). there are two blocks: resampling
+//writes the next states into the spare block and swaps the block index. the
+//blocks hold a capacity of particles, and within it the number of particles
+//can change (e.g. at each resampling) without allocating
+template <typename T>
+class pfParticleStore
+{
+private:
+
+    std::vector<T> block[2];
+    unsigned int n;
+    unsigned int cap;
+    unsigned int cur;
+
+    T *at(unsigned int b, unsigned int state) { return &block[b][state * cap]; }
+
+public:
+
+    pfParticleStore() : n(0), cap(0), cur(0) {}
+
+    //room for n particles, keeping the current ones
+    void reserve(unsigned int n)
+    {
+        if(n <= cap) return;
+        std::vector<T> grown(4 * n);
+        for(unsigned int s = 0; s < 4; s++)
+            for(unsigned int i = 0; i < this->n; i++)
+                grown[s * n + i] = block[cur][s * cap + i];
+        block[cur].swap(grown);
+        block[cur ^ 1].assign(4 * n, T(0.0));
+        cap = n;
+    }
+
+    void resize(unsigned int n)
+    {
+        reserve(n);
+        this->n = n;
+    }
+
+    unsigned int size() const { return n; }
+    unsigned int capacity() const { return cap; }
+
+    T *x() { return at(cur, 0); }
+    T *y() { return at(cur, 1); }
+    T *r() { return at(cur, 2); }
+    T *w() { return at(cur, 3); }
+    const T *x() const { return &block[cur][0]; }
+    const T *y() const { return &block[cur][cap]; }
+    const T *r() const { return &block[cur][2 * cap]; }
+    const T *w() const { return &block[cur][3 * cap]; }
+
+    pfParticle<T> get(unsigned int i) const
+    {
+        const T *b = block[cur].data();
+        pfParticle<T> p = {b[i], b[cap + i], b[2 * cap + i], b[3 * cap + i]};
+        return p;
+    }
+
+    void set(unsigned int i, const pfParticle<T> &p)
+    {
+        T *b = block[cur].data();
+        b[i] = p.x; b[cap + i] = p.y; b[2 * cap + i] = p.r; b[3 * cap + i] = p.w;
+    }
+
+    //copies particle j of the current block to particle i of the spare block
+    void copyToSpare(unsigned int i, unsigned int j)
+    {
+        const T *from = block[cur].data();
+        T *to = block[cur ^ 1].data();
+        for(unsigned int s = 0; s < 4 * cap; s += cap)
+            to[s + i] = from[s + j];
+    }
+
+    void swap() { cur ^= 1; }
+
+    //swaps to the spare block holding n (<= capacity) particles
+    void swap(unsigned int n) { cur ^= 1; this->n = n; }
+
+};
+
+struct pfEvent {
+    int16_t x;
+    int16_t y;
+};
+
+//the 15 bit uniform numbers of MY_RAND (spin1_rand() & 0x7FFF as an accum)
+//from a xorshift generator
+class pfRandom
+{
+private:
+
+    uint32_t s;
+
+public:
+
+    pfRandom(uint32_t seed = 1) : s(seed ? seed : 1) {}
+
+    void seed(uint32_t seed) { s = seed ? seed : 1; }
+
+    uint32_t next()
+    {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+
+    //in [0, 1) with 2^-15 steps
+    template <typename T>
+    T uniform() { return T((double)(next() & 0x7FFF) / 32768.0); }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  EVENT WINDOW
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the most recent events shared by all particles, visited newest first like
+//event_window/start_window/size_window on the particle cores
+class pfEventWindow
+{
+private:
+
+    pfEvent events[PF_EVENT_WINDOW_SIZE];
+    unsigned int start;
+    unsigned int n;
+
+public:
+
+    pfEventWindow() : start(0), n(0) {}
+
+    void clear() { start = 0; n = 0; }
+    unsigned int size() const { return n; }
+    bool full() const { return n == PF_EVENT_WINDOW_SIZE; }
+
+    //the slot of the newest event, the slot the next event will overwrite
+    //and the event in a slot
+    unsigned int newest() const { return start; }
+    unsigned int next() const { return (start + 1) % PF_EVENT_WINDOW_SIZE; }
+    const pfEvent &at(unsigned int slot) const { return events[slot]; }
+
+    void add(const pfEvent &e)
+    {
+        start = (start + 1) % PF_EVENT_WINDOW_SIZE;
+        events[start] = e;
+        if(n < PF_EVENT_WINDOW_SIZE) n++;
+    }
+
+    //the i-th newest event
+    const pfEvent &operator[](unsigned int i) const
+    {
+        return events[(start + PF_EVENT_WINDOW_SIZE - i) % PF_EVENT_WINDOW_SIZE];
+    }
+
+};
+
+//events waiting to enter the window (retina_buffer)
+class pfEventQueue
+{
+private:
+
+    std::vector<pfEvent> q;
+    unsigned int head;
+    unsigned int n;
+
+public:
+
+    unsigned int dropped;
+
+    pfEventQueue(unsigned int capacity = PF_RETINA_BUFFER_SIZE) :
+        q(capacity), head(0), n(0), dropped(0) {}
+
+    unsigned int size() const { return n; }
+
+    bool push(const pfEvent &e)
+    {
+        if(n == q.size()) {
+            dropped++;
+            return false;
+        }
+        q[(head + n++) % q.size()] = e;
+        return true;
+    }
+
+    bool pop(pfEvent &e)
+    {
+        if(!n) return false;
+        e = q[head];
+        head = (head + 1) % q.size();
+        n--;
+        return true;
+    }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ALGORITHM
+  ////////////////////////////////////////////////////////////////////////////*/
+
+template <typename T>
+inline T pfApproxAtan2(T y, T x)
+{
+    const T zero(0.0);
+    T absy = y < zero ? -y : y;
+    T absx = x < zero ? -x : x;
+    T a = absy < absx ? absy / absx : absx / absy;
+    T r = a * (T(PF_PI_4) - (a - T(1.0)) * T(0.2733185));
+    if(absy > absx) r = T(1.57079637) - r;
+    if(x < zero) r = T(3.14159274) - r;
+    if(y < zero) r = -r;
+
+    return r;
+}
+
+//sqrt of every integer squared distance within MAX_RADIUS_PLUS2 (LUT_SQRT)
+template <typename T>
+inline void pfBuildSqrtTable(std::vector<T> &lut)
+{
+    lut.resize(PF_MAX_RADIUS_PLUS2_SQRD + 1);
+    for(unsigned int i = 0; i < lut.size(); i++)
+        lut[i] = T(std::sqrt((double)i));
+}
+
+//the likelihood of a circle at the particle given n events, newest first,
+//where event(i) is the i-th (calculate_likelihood)
+template <typename T, typename F>
+inline T pfLikelihoodOf(const pfParticle<T> &p, unsigned int n, F event,
+                        const T *lutsqrt)
+{
+    const T inlierplus1(PF_INLIER_PAR_PLUS1);
+    const T maxd2(PF_MAX_RADIUS_PLUS2_SQRD);
+    T L[PF_ANG_BUCKETS];
+    for(int i = 0; i < PF_ANG_BUCKETS; i++) L[i] = T(0.0);
+
+    T l(PF_MIN_LIKE);
+    T score(0.0);
+    T negativescaler = T(PF_NEG_BIAS_CONSTANT) / (p.r * p.r);
+
+    for(unsigned int i = 0; i < n; i++) {
+
+        const pfEvent &e = event(i);
+        T dx = T((int)e.x) - p.x;
+        T dy = T((int)e.y) - p.y;
+        T D2 = dx * dx + dy * dy;
+        if(D2 > maxd2) continue;
+
+        T D = lutsqrt[(int)(D2 + T(0.5))];
+        if(!(D < p.r + inlierplus1)) continue;
+
+        T absdr = D > p.r ? D - p.r : p.r - D;
+        if(absdr <= inlierplus1) {
+            int li = (int)(T(0.5) + T(PF_BUCKET_SCALE) *
+                           (pfApproxAtan2(dy, dx) + T(PF_PI)));
+            T cval = absdr < T(1.0) ? T(1.0) :
+                                      (inlierplus1 - absdr) * T(PF_INV_INLIER_PAR);
+            if(cval > L[li]) {
+                score = (score + cval) - L[li];
+                L[li] = cval;
+                if(score > l) l = score;
+            }
+        } else {
+            score -= negativescaler;
+        }
+    }
+
+    return l;
+}
+
+template <typename T>
+inline T pfLikelihood(const pfParticle<T> &p, const pfEventWindow &window,
+                      const T *lutsqrt)
+{
+    return pfLikelihoodOf(p, window.size(),
+                          [&window](unsigned int i) -> const pfEvent & {
+        return window[i];
+    }, lutsqrt);
+}
+
+template <typename T>
+inline T pfLikelihood(const pfParticle<T> &p, const pfEvent *events,
+                      unsigned int n, const T *lutsqrt)
+{
+    return pfLikelihoodOf(p, n, [events](unsigned int i) -> const pfEvent & {
+        return events[i];
+    }, lutsqrt);
+}
+
+//random walk of the state (predict)
+template <typename T>
+inline void pfPredict(pfParticle<T> &p, T sigma, pfRandom &rng)
+{
+    const T two(2.0);
+    p.x += two * sigma * rng.uniform<T>() - sigma;
+    p.y += two * sigma * rng.uniform<T>() - sigma;
+    p.r += T(0.2) * (two * sigma * rng.uniform<T>() - sigma);
+
+    if(p.r < T(PF_MIN_RADIUS)) p.r = T(PF_MIN_RADIUS);
+    if(p.r > T(PF_MAX_RADIUS)) p.r = T(PF_MAX_RADIUS);
+    if(p.x < T(0.0)) p.x = T(0.0);
+    if(p.x > T(PF_RETINA_WIDTH)) p.x = T(PF_RETINA_WIDTH);
+    if(p.y < T(0.0)) p.y = T(0.0);
+    if(p.y > T(PF_RETINA_HEIGHT)) p.y = T(PF_RETINA_HEIGHT);
+}
+
+//normalises the weights and returns the weighted mean state (normalise)
+template <typename T>
+inline void pfNormalise(pfParticleStore<T> &p, T target[3])
+{
+    unsigned int n = p.size();
+    const T *x = p.x(), *y = p.y(), *r = p.r();
+    T *w = p.w();
+
+    T total(0.0);
+    for(unsigned int i = 0; i < n; i++)
+        total += w[i];
+    total = T(1.0) / total;
+
+    target[0] = target[1] = target[2] = T(0.0);
+    for(unsigned int i = 0; i < n; i++) {
+        w[i] *= total;
+        target[0] += x[i] * w[i];
+        target[1] += y[i] * w[i];
+        target[2] += r[i] * w[i];
+    }
+}
+
+//the index of the particle at which the cumulative weight first exceeds rn
+//(unload_weighted_random_particle)
+template <typename T>
+inline unsigned int pfWeightedRandom(const T *w, unsigned int n, T rn)
+{
+    T sum(0.0);
+    unsigned int i;
+    for(i = 0; i < n; i++) {
+        sum += w[i];
+        if(sum > rn) break;
+    }
+    if(i == n) i--;
+
+    return i;
+}
+
+#endif
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_GRID__
+#define __PF_HOST_GRID__
+
+#include <stdint.h>
+#include <cstring>
+#include "pf_fullparticle.h"
+
+#define PF_GRID_CELL            16      // [px]
+#define PF_GRID_WIDTH           ((PF_RETINA_WIDTH + PF_GRID_CELL - 1) / PF_GRID_CELL)
+#define PF_GRID_HEIGHT          ((PF_RETINA_HEIGHT + PF_GRID_CELL - 1) / PF_GRID_CELL)
+#define PF_GRID_WORDS           (PF_EVENT_WINDOW_SIZE / 64)
+
+/*//////////////////////////////////////////////////////////////////////////////
+  EVENT GRID
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the window slots of the events in each PF_GRID_CELL square of the sensor, as
+//one bit a slot. add() and remove() keep it in step with the window as events
+//enter and leave; near() gathers, newest first, the events of the cells under
+//a square, so a particle only visits the events that can reach its annulus
+class pfEventGrid
+{
+private:
+
+    uint64_t cells[PF_GRID_WIDTH * PF_GRID_HEIGHT][PF_GRID_WORDS];
+
+    static int column(int x)
+    {
+        x /= PF_GRID_CELL;
+        return x < 0 ? 0 : (x >= PF_GRID_WIDTH ? PF_GRID_WIDTH - 1 : x);
+    }
+
+    static int row(int y)
+    {
+        y /= PF_GRID_CELL;
+        return y < 0 ? 0 : (y >= PF_GRID_HEIGHT ? PF_GRID_HEIGHT - 1 : y);
+    }
+
+    uint64_t *cell(const pfEvent &e)
+    {
+        return cells[row(e.y) * PF_GRID_WIDTH + column(e.x)];
+    }
+
+public:
+
+    pfEventGrid() { clear(); }
+
+    void clear() { std::memset(cells, 0, sizeof(cells)); }
+
+    void add(unsigned int slot, const pfEvent &e)
+    {
+        cell(e)[slot >> 6] |= (uint64_t)1 << (slot & 63);
+    }
+
+    void remove(unsigned int slot, const pfEvent &e)
+    {
+        cell(e)[slot >> 6] &= ~((uint64_t)1 << (slot & 63));
+    }
+
+    //adds e to the window, moving the event it overwrites out of the grid
+    void push(pfEventWindow &window, const pfEvent &e)
+    {
+        if(window.full())
+            remove(window.next(), window.at(window.next()));
+        window.add(e);
+        add(window.newest(), e);
+    }
+
+    //the slots of the cells under [x0, x1] x [y0, y1] into m
+    void mask(int x0, int y0, int x1, int y1, uint64_t *m) const
+    {
+        for(int w = 0; w < PF_GRID_WORDS; w++)
+            m[w] = 0;
+        int c0 = column(x0), c1 = column(x1);
+        for(int r = row(y0); r <= row(y1); r++)
+            for(int c = c0; c <= c1; c++)
+                for(int w = 0; w < PF_GRID_WORDS; w++)
+                    m[w] |= cells[r * PF_GRID_WIDTH + c][w];
+    }
+
+    //the number of events within the cells under [x0, x1] x [y0, y1]
+    unsigned int count(int x0, int y0, int x1, int y1) const
+    {
+        uint64_t m[PF_GRID_WORDS];
+        mask(x0, y0, x1, y1, m);
+        unsigned int n = 0;
+        for(int w = 0; w < PF_GRID_WORDS; w++)
+            n += __builtin_popcountll(m[w]);
+        return n;
+    }
+
+    //the events of window within the cells under [x0, x1] x [y0, y1], newest
+    //first, into out (of PF_EVENT_WINDOW_SIZE). returns the number found
+    unsigned int near(const pfEventWindow &window, int x0, int y0, int x1,
+                      int y1, pfEvent *out) const
+    {
+        uint64_t m[PF_GRID_WORDS];
+        mask(x0, y0, x1, y1, m);
+
+        //slots newest first: newest down to 0, then the top down to newest + 1
+        unsigned int n = 0;
+        int start = window.newest();
+        int sw = start >> 6;
+        uint64_t low = (start & 63) == 63 ? ~(uint64_t)0 :
+                                            ((uint64_t)1 << ((start & 63) + 1)) - 1;
+
+        auto visit = [&](int w, uint64_t bits) {
+            while(bits) {
+                int b = 63 - __builtin_clzll(bits);
+                bits &= ~((uint64_t)1 << b);
+                out[n++] = window.at((w << 6) + b);
+            }
+        };
+
+        visit(sw, m[sw] & low);
+        for(int w = sw - 1; w >= 0; w--)
+            visit(w, m[w]);
+        for(int w = PF_GRID_WORDS - 1; w > sw; w--)
+            visit(w, m[w]);
+        visit(sw, m[sw] & ~low);
+
+        return n;
+    }
+
+    //the events that can count towards the likelihood of p: those within
+    //r + PF_INLIER_PAR_PLUS1 (and a pixel for the rounding of D2)
+    template <typename T>
+    unsigned int near(const pfEventWindow &window, const pfParticle<T> &p,
+                      pfEvent *out) const
+    {
+        int half = (int)(p.r + T(PF_INLIER_PAR_PLUS1 + 1.0)) + 1;
+        int x = (int)p.x, y = (int)p.y;
+        return near(window, x - half, y - half, x + half, y + half, out);
+    }
+
+    //the number of events near() would visit for p
+    template <typename T>
+    unsigned int count(const pfParticle<T> &p) const
+    {
+        int half = (int)(p.r + T(PF_INLIER_PAR_PLUS1 + 1.0)) + 1;
+        int x = (int)p.x, y = (int)p.y;
+        return count(x - half, y - half, x + half, y + half);
+    }
+
+};
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_POLAR__
+#define __PF_HOST_POLAR__
+
+#include "pf_fullparticle.h"
+#include "../pf_spinn/common/pf_polar_lut.h"
+
+#if PF_POLAR_RANGE != PF_MAX_RADIUS_PLUS2
+#error "pf_polar_lut.h was generated for another MAX_RADIUS_PLUS2"
+#endif
+
+/*//////////////////////////////////////////////////////////////////////////////
+  POLAR LIKELIHOOD
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the distance of a table entry
+template <typename T>
+inline T pfPolarDistance(uint32_t e)
+{
+    return T((double)PF_POLAR_DIST_BITS(e) * (1.0 / 32768.0));
+}
+
+template <>
+inline float pfPolarDistance<float>(uint32_t e)
+{
+    return (float)PF_POLAR_DIST_BITS(e) * (1.0f / 32768.0f);
+}
+
+template <>
+inline pfAccum pfPolarDistance<pfAccum>(uint32_t e)
+{
+    return pfAccum::fromBits(PF_POLAR_DIST_BITS(e));
+}
+
+//pfLikelihoodOf with the distance and bucket of each event read together
+//from pf_polar_lut. the particle centre is rounded to the table's resolution
+//(a pixel) so that the offsets are table indices; the radius is not rounded
+template <typename T, typename F>
+inline T pfLikelihoodPolarOf(const pfParticle<T> &p, unsigned int n, F event)
+{
+    const T inlierplus1(PF_INLIER_PAR_PLUS1);
+    T L[PF_ANG_BUCKETS];
+    for(int i = 0; i < PF_ANG_BUCKETS; i++) L[i] = T(0.0);
+
+    T l(PF_MIN_LIKE);
+    T score(0.0);
+    T negativescaler = T(PF_NEG_BIAS_CONSTANT) / (p.r * p.r);
+    T rplus = p.r + inlierplus1;
+    int px = (int)(p.x * T(PF_POLAR_SUB) + T(0.5));
+    int py = (int)(p.y * T(PF_POLAR_SUB) + T(0.5));
+
+    for(unsigned int i = 0; i < n; i++) {
+
+        const pfEvent &e = event(i);
+        int dx = e.x * PF_POLAR_SUB - px;
+        int dy = e.y * PF_POLAR_SUB - py;
+        if((unsigned int)(dx + PF_POLAR_HALF) >= PF_POLAR_SIZE ||
+           (unsigned int)(dy + PF_POLAR_HALF) >= PF_POLAR_SIZE)
+            continue;
+
+        uint32_t polar = pf_polar_lut[PF_POLAR_INDEX(dx, dy)];
+        T D = pfPolarDistance<T>(polar);
+        if(!(D < rplus)) continue;
+
+        T absdr = D > p.r ? D - p.r : p.r - D;
+        if(absdr <= inlierplus1) {
+            int li = PF_POLAR_BUCKET(polar);
+            T cval = absdr < T(1.0) ? T(1.0) :
+                                      (inlierplus1 - absdr) * T(PF_INV_INLIER_PAR);
+            if(cval > L[li]) {
+                score = (score + cval) - L[li];
+                L[li] = cval;
+                if(score > l) l = score;
+            }
+        } else {
+            score -= negativescaler;
+        }
+    }
+
+    return l;
+}
+
+template <typename T>
+inline T pfLikelihoodPolar(const pfParticle<T> &p, const pfEventWindow &window)
+{
+    return pfLikelihoodPolarOf(p, window.size(),
+                               [&window](unsigned int i) -> const pfEvent & {
+        return window[i];
+    });
+}
+
+template <typename T>
+inline T pfLikelihoodPolar(const pfParticle<T> &p, const pfEvent *events,
+                           unsigned int n)
+{
+    return pfLikelihoodPolarOf(p, n, [events](unsigned int i) -> const pfEvent & {
+        return events[i];
+    });
+}
+
+#endif
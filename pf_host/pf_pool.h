@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_POOL__
+#define __PF_HOST_POOL__
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  WORK-STEALING POOL
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//runs job(batch, worker) for every batch of a set on a fixed number of
+//workers, the calling thread being worker 0. each worker starts on its own
+//contiguous share of the batches, taken from the front, and once that is
+//empty takes batches from the back of the other shares. run() returns when
+//every batch is done
+class pfWorkPool
+{
+private:
+
+    //the batches [begin, end) left to a worker, packed as end << 32 | begin
+    //so that the owner and the thieves agree on them with one compare and
+    //swap. padded to a cache line each
+    struct share {
+        std::atomic<uint64_t> range;
+        char pad[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    std::vector<std::thread> threads;
+    std::vector<share> shares;
+    std::function<void(unsigned int, unsigned int)> job;
+
+    std::mutex m;
+    std::condition_variable wake;
+    std::condition_variable done;
+    unsigned int generation;
+    unsigned int busy;
+    bool stop;
+
+    bool popFront(unsigned int w, unsigned int &batch)
+    {
+        uint64_t r = shares[w].range.load(std::memory_order_relaxed);
+        while(true) {
+            uint32_t b = (uint32_t)r, e = (uint32_t)(r >> 32);
+            if(b >= e) return false;
+            if(shares[w].range.compare_exchange_weak(r, (uint64_t)e << 32 | (b + 1),
+                                                     std::memory_order_acq_rel)) {
+                batch = b;
+                return true;
+            }
+        }
+    }
+
+    bool popBack(unsigned int w, unsigned int &batch)
+    {
+        uint64_t r = shares[w].range.load(std::memory_order_relaxed);
+        while(true) {
+            uint32_t b = (uint32_t)r, e = (uint32_t)(r >> 32);
+            if(b >= e) return false;
+            if(shares[w].range.compare_exchange_weak(r, (uint64_t)(e - 1) << 32 | b,
+                                                     std::memory_order_acq_rel)) {
+                batch = e - 1;
+                return true;
+            }
+        }
+    }
+
+    void work(unsigned int w)
+    {
+        unsigned int n = shares.size();
+        unsigned int batch;
+        while(true) {
+            if(popFront(w, batch)) {
+                job(batch, w);
+                continue;
+            }
+            bool stolen = false;
+            for(unsigned int i = 1; i < n && !stolen; i++)
+                stolen = popBack((w + i) % n, batch);
+            if(!stolen) return;
+            job(batch, w);
+        }
+    }
+
+    void loop(unsigned int w)
+    {
+        unsigned int seen = 0;
+        while(true) {
+            {
+                std::unique_lock<std::mutex> lock(m);
+                wake.wait(lock, [&]{ return stop || generation != seen; });
+                if(stop) return;
+                seen = generation;
+            }
+
+            work(w);
+
+            std::lock_guard<std::mutex> lock(m);
+            if(--busy == 0) done.notify_one();
+        }
+    }
+
+public:
+
+    pfWorkPool(unsigned int workers = 1) : generation(0), busy(0), stop(false)
+    {
+        if(!workers) workers = 1;
+        shares = std::vector<share>(workers);
+        for(unsigned int w = 1; w < workers; w++)
+            threads.push_back(std::thread(&pfWorkPool::loop, this, w));
+    }
+
+    ~pfWorkPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            stop = true;
+        }
+        wake.notify_all();
+        for(unsigned int i = 0; i < threads.size(); i++)
+            threads[i].join();
+    }
+
+    unsigned int workers() const { return shares.size(); }
+
+    void run(unsigned int batches,
+             const std::function<void(unsigned int, unsigned int)> &f)
+    {
+        unsigned int n = shares.size();
+        for(unsigned int w = 0; w < n; w++) {
+            uint64_t b = (uint64_t)batches * w / n;
+            uint64_t e = (uint64_t)batches * (w + 1) / n;
+            shares[w].range.store(e << 32 | b, std::memory_order_relaxed);
+        }
+        job = f;
+
+        if(n > 1) {
+            {
+                std::lock_guard<std::mutex> lock(m);
+                busy = n - 1;
+                generation++;
+            }
+            wake.notify_all();
+        }
+
+        work(0);
+
+        if(n > 1) {
+            std::unique_lock<std::mutex> lock(m);
+            done.wait(lock, [this]{ return busy == 0; });
+        }
+    }
+
+};
+
+#endif
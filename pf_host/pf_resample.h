@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_RESAMPLE__
+#define __PF_HOST_RESAMPLE__
+
+#include <string>
+#include <vector>
+#include "pf_fullparticle.h"
+
+//the schemes of pf_spinn/common/pf_resample.h plus the original scan of
+//unload_weighted_random_particle (one uniform number and one scan per draw)
+enum pfResampleScheme {
+    PF_MULTINOMIAL, PF_SYSTEMATIC, PF_STRATIFIED, PF_RESIDUAL
+};
+
+inline bool pfResampleSchemeFromName(const std::string &name,
+                                     pfResampleScheme &scheme)
+{
+    if(name == "multinomial") scheme = PF_MULTINOMIAL;
+    else if(name == "systematic") scheme = PF_SYSTEMATIC;
+    else if(name == "stratified") scheme = PF_STRATIFIED;
+    else if(name == "residual") scheme = PF_RESIDUAL;
+    else return false;
+    return true;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  RESAMPLING
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the draws (k + u[k]) / m against one scan of the cumulative weights. u is a
+//single offset if ustep is 0 (systematic) or one number a draw (stratified)
+template <typename T>
+inline void pfResampleOrdered(const T *w, unsigned int n, unsigned int m,
+                              const T *u, unsigned int ustep, unsigned int *out)
+{
+    const T mt = T((int)m);
+    T sum = w[0];
+    unsigned int j = 0;
+    for(unsigned int k = 0; k < m; k++) {
+        T target = (T((int)k) + u[k * ustep]) / mt;
+        while(!(sum > target) && j < n - 1)
+            sum += w[++j];
+        out[k] = j;
+    }
+}
+
+//floor(m w) copies of every particle, then systematic draws over what is
+//left of m w. the weights must be normalised
+template <typename T>
+inline void pfResampleResidual(const T *w, unsigned int n, unsigned int m, T u,
+                               unsigned int *out)
+{
+    const T mt = T((int)m);
+    unsigned int k = 0;
+    for(unsigned int i = 0; i < n; i++) {
+        int copies = (int)(mt * w[i]);
+        for(int c = 0; c < copies && k < m; c++)
+            out[k++] = i;
+    }
+
+    //the residuals m w - floor(m w) sum to m - k: draw (d + u) against them
+    T sum(0.0);
+    unsigned int j = 0, d = 0;
+    for(; k < m; k++, d++) {
+        T target = T((int)d) + u;
+        while(j < n) {
+            T res = mt * w[j];
+            res = res - T((int)res);
+            if(sum + res > target) break;
+            sum += res;
+            j++;
+        }
+        out[k] = j < n ? j : n - 1;
+    }
+}
+
+//m draws from the n normalised weights w into out. the ordered schemes take
+//one prefix sum of the weights and are O(n + m); multinomial is O(n m)
+template <typename T>
+inline void pfResample(pfResampleScheme scheme, const T *w, unsigned int n,
+                       unsigned int m, pfRandom &rng, unsigned int *out,
+                       std::vector<T> &uniforms)
+{
+    switch(scheme) {
+    case PF_MULTINOMIAL:
+        for(unsigned int i = 0; i < m; i++)
+            out[i] = pfWeightedRandom(w, n, rng.uniform<T>());
+        break;
+    case PF_SYSTEMATIC: {
+        T u = rng.uniform<T>();
+        pfResampleOrdered(w, n, m, &u, 0, out);
+        break;
+    }
+    case PF_STRATIFIED:
+        uniforms.resize(m);
+        for(unsigned int i = 0; i < m; i++)
+            uniforms[i] = rng.uniform<T>();
+        pfResampleOrdered(w, n, m, uniforms.data(), 1, out);
+        break;
+    case PF_RESIDUAL:
+        pfResampleResidual(w, n, m, rng.uniform<T>(), out);
+        break;
+    }
+}
+
+#endif
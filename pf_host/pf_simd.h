@@ -0,0 +1,318 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __PF_HOST_SIMD__
+#define __PF_HOST_SIMD__
+
+#include <vector>
+#include "pf_fullparticle.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PF_SIMD_WIDTH 8
+#define PF_SIMD_NAME "avx2"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PF_SIMD_WIDTH 4
+#define PF_SIMD_NAME "sse2"
+#else
+#define PF_SIMD_WIDTH 1
+#define PF_SIMD_NAME "scalar"
+#endif
+
+/*//////////////////////////////////////////////////////////////////////////////
+  EVENTS AS ARRAYS
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the window as flat coordinate arrays, newest first. the arrays are padded to
+//a multiple of the vector width with events that are never near a particle
+class pfEventArrays
+{
+public:
+
+    std::vector<float> x;
+    std::vector<float> y;
+    unsigned int n;
+
+    pfEventArrays() : n(0) {}
+
+    void reserve(unsigned int capacity)
+    {
+        unsigned int padded = capacity + PF_SIMD_WIDTH;
+        x.reserve(padded);
+        y.reserve(padded);
+    }
+
+    template <typename F>
+    void fill(unsigned int count, F event)
+    {
+        n = count;
+        unsigned int padded = (n + PF_SIMD_WIDTH - 1) / PF_SIMD_WIDTH *
+                PF_SIMD_WIDTH;
+        x.resize(padded);
+        y.resize(padded);
+        for(unsigned int i = 0; i < n; i++) {
+            const pfEvent &e = event(i);
+            x[i] = e.x;
+            y[i] = e.y;
+        }
+        for(unsigned int i = n; i < padded; i++) {
+            x[i] = -1e4f;
+            y[i] = -1e4f;
+        }
+    }
+
+    void load(const pfEventWindow &window)
+    {
+        fill(window.size(), [&window](unsigned int i) -> const pfEvent & {
+            return window[i];
+        });
+    }
+
+    void load(const pfEvent *events, unsigned int count)
+    {
+        fill(count, [events](unsigned int i) -> const pfEvent & {
+            return events[i];
+        });
+    }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SCALAR REFERENCE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//pfLikelihood<float> over event arrays of any length
+inline float pfLikelihoodScalar(const pfParticle<float> &p,
+                                const pfEventArrays &ev, const float *lutsqrt)
+{
+    float L[PF_ANG_BUCKETS] = {0};
+    float l = PF_MIN_LIKE;
+    float score = 0.0f;
+    float negativescaler = (float)PF_NEG_BIAS_CONSTANT / (p.r * p.r);
+
+    for(unsigned int i = 0; i < ev.n; i++) {
+        float dx = ev.x[i] - p.x;
+        float dy = ev.y[i] - p.y;
+        float D2 = dx * dx + dy * dy;
+        if(D2 > PF_MAX_RADIUS_PLUS2_SQRD) continue;
+
+        float D = lutsqrt[(int)(D2 + 0.5f)];
+        if(!(D < p.r + (float)PF_INLIER_PAR_PLUS1)) continue;
+
+        float absdr = D > p.r ? D - p.r : p.r - D;
+        if(absdr <= (float)PF_INLIER_PAR_PLUS1) {
+            int li = (int)(0.5f + (float)PF_BUCKET_SCALE *
+                           (pfApproxAtan2(dy, dx) + (float)PF_PI));
+            float cval = absdr < 1.0f ? 1.0f :
+                    ((float)PF_INLIER_PAR_PLUS1 - absdr) *
+                    (float)PF_INV_INLIER_PAR;
+            if(cval > L[li]) {
+                score = (score + cval) - L[li];
+                L[li] = cval;
+                if(score > l) l = score;
+            }
+        } else {
+            score -= negativescaler;
+        }
+    }
+
+    return l;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  VECTOR OPERATIONS
+  ////////////////////////////////////////////////////////////////////////////*/
+
+#if PF_SIMD_WIDTH == 8
+
+typedef __m256 pfvf;
+typedef __m256i pfvi;
+inline pfvf pfv_set(float a) { return _mm256_set1_ps(a); }
+inline pfvf pfv_load(const float *p) { return _mm256_loadu_ps(p); }
+inline pfvf pfv_add(pfvf a, pfvf b) { return _mm256_add_ps(a, b); }
+inline pfvf pfv_sub(pfvf a, pfvf b) { return _mm256_sub_ps(a, b); }
+inline pfvf pfv_mul(pfvf a, pfvf b) { return _mm256_mul_ps(a, b); }
+inline pfvf pfv_div(pfvf a, pfvf b) { return _mm256_div_ps(a, b); }
+inline pfvf pfv_min(pfvf a, pfvf b) { return _mm256_min_ps(a, b); }
+inline pfvf pfv_max(pfvf a, pfvf b) { return _mm256_max_ps(a, b); }
+inline pfvf pfv_sqrt(pfvf a) { return _mm256_sqrt_ps(a); }
+inline pfvf pfv_and(pfvf a, pfvf b) { return _mm256_and_ps(a, b); }
+inline pfvf pfv_andnot(pfvf a, pfvf b) { return _mm256_andnot_ps(a, b); }
+inline pfvf pfv_or(pfvf a, pfvf b) { return _mm256_or_ps(a, b); }
+inline pfvf pfv_xor(pfvf a, pfvf b) { return _mm256_xor_ps(a, b); }
+inline pfvf pfv_lt(pfvf a, pfvf b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline pfvf pfv_le(pfvf a, pfvf b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+inline pfvf pfv_gt(pfvf a, pfvf b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+inline int pfv_mask(pfvf a) { return _mm256_movemask_ps(a); }
+inline pfvi pfv_trunc(pfvf a) { return _mm256_cvttps_epi32(a); }
+inline pfvf pfv_float(pfvi a) { return _mm256_cvtepi32_ps(a); }
+inline void pfv_store(float *p, pfvf a) { _mm256_storeu_ps(p, a); }
+inline void pfv_store(int *p, pfvi a) { _mm256_storeu_si256((pfvi *)p, a); }
+
+#elif PF_SIMD_WIDTH == 4
+
+typedef __m128 pfvf;
+typedef __m128i pfvi;
+inline pfvf pfv_set(float a) { return _mm_set1_ps(a); }
+inline pfvf pfv_load(const float *p) { return _mm_loadu_ps(p); }
+inline pfvf pfv_add(pfvf a, pfvf b) { return _mm_add_ps(a, b); }
+inline pfvf pfv_sub(pfvf a, pfvf b) { return _mm_sub_ps(a, b); }
+inline pfvf pfv_mul(pfvf a, pfvf b) { return _mm_mul_ps(a, b); }
+inline pfvf pfv_div(pfvf a, pfvf b) { return _mm_div_ps(a, b); }
+inline pfvf pfv_min(pfvf a, pfvf b) { return _mm_min_ps(a, b); }
+inline pfvf pfv_max(pfvf a, pfvf b) { return _mm_max_ps(a, b); }
+inline pfvf pfv_sqrt(pfvf a) { return _mm_sqrt_ps(a); }
+inline pfvf pfv_and(pfvf a, pfvf b) { return _mm_and_ps(a, b); }
+inline pfvf pfv_andnot(pfvf a, pfvf b) { return _mm_andnot_ps(a, b); }
+inline pfvf pfv_or(pfvf a, pfvf b) { return _mm_or_ps(a, b); }
+inline pfvf pfv_xor(pfvf a, pfvf b) { return _mm_xor_ps(a, b); }
+inline pfvf pfv_lt(pfvf a, pfvf b) { return _mm_cmplt_ps(a, b); }
+inline pfvf pfv_le(pfvf a, pfvf b) { return _mm_cmple_ps(a, b); }
+inline pfvf pfv_gt(pfvf a, pfvf b) { return _mm_cmpgt_ps(a, b); }
+inline int pfv_mask(pfvf a) { return _mm_movemask_ps(a); }
+inline pfvi pfv_trunc(pfvf a) { return _mm_cvttps_epi32(a); }
+inline pfvf pfv_float(pfvi a) { return _mm_cvtepi32_ps(a); }
+inline void pfv_store(float *p, pfvf a) { _mm_storeu_ps(p, a); }
+inline void pfv_store(int *p, pfvi a) { _mm_storeu_si128((pfvi *)p, a); }
+
+#endif
+
+/*//////////////////////////////////////////////////////////////////////////////
+  VECTOR LIKELIHOOD
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//pfLikelihoodScalar with the distance, annulus test, angle and bucket of
+//PF_SIMD_WIDTH events computed at once. the vector pass keeps (in order) only
+//the events that change the score; the bucket maxima and the running score
+//depend on the event order and are updated in a scalar pass over those. the
+//sqrt of the rounded squared distance is computed rather than looked up, which
+//gives the same values as LUT_SQRT. the scratch space is kept between calls,
+//so one kernel must be used by one thread at a time
+class pfLikelihoodKernel
+{
+private:
+
+    //bucket of each kept event and its value. the bucket is -1 for an event
+    //within r + PF_INLIER_PAR_PLUS1 that is not an inlier (well inside the
+    //annulus), which only lowers the score by the negative bias
+    std::vector<int> bucket;
+    std::vector<float> cval;
+    std::vector<float> lutsqrt;
+
+public:
+
+    pfLikelihoodKernel() { pfBuildSqrtTable(lutsqrt); }
+
+    float operator()(const pfParticle<float> &p, const pfEventArrays &ev)
+    {
+#if PF_SIMD_WIDTH == 1
+        return pfLikelihoodScalar(p, ev, lutsqrt.data());
+#else
+        if(bucket.size() < ev.x.size()) {
+            bucket.resize(ev.x.size());
+            cval.resize(ev.x.size());
+        }
+
+        const pfvf px = pfv_set(p.x);
+        const pfvf py = pfv_set(p.y);
+        const pfvf pr = pfv_set(p.r);
+        const pfvf maxd2 = pfv_set(PF_MAX_RADIUS_PLUS2_SQRD);
+        const pfvf half = pfv_set(0.5f);
+        const pfvf one = pfv_set(1.0f);
+        const pfvf inlierplus1 = pfv_set(PF_INLIER_PAR_PLUS1);
+        const pfvf rplus = pfv_set(p.r + (float)PF_INLIER_PAR_PLUS1);
+        const pfvf signbit = pfv_set(-0.0f);
+
+        unsigned int m = 0;
+        float vcval[PF_SIMD_WIDTH];
+        int vbucket[PF_SIMD_WIDTH];
+
+        for(unsigned int i = 0; i < ev.n; i += PF_SIMD_WIDTH) {
+
+            pfvf dx = pfv_sub(pfv_load(&ev.x[i]), px);
+            pfvf dy = pfv_sub(pfv_load(&ev.y[i]), py);
+            pfvf D2 = pfv_add(pfv_mul(dx, dx), pfv_mul(dy, dy));
+            pfvf near = pfv_le(D2, maxd2);
+            if(!pfv_mask(near)) continue;
+
+            pfvf D = pfv_sqrt(pfv_float(pfv_trunc(pfv_add(D2, half))));
+            near = pfv_and(near, pfv_lt(D, rplus));
+            int nearmask = pfv_mask(near);
+            if(!nearmask) continue;
+
+            pfvf absdr = pfv_andnot(signbit, pfv_sub(D, pr));
+            pfvf inlier = pfv_le(absdr, inlierplus1);
+
+            //approxatan2
+            pfvf absx = pfv_andnot(signbit, dx);
+            pfvf absy = pfv_andnot(signbit, dy);
+            pfvf a = pfv_div(pfv_min(absx, absy), pfv_max(absx, absy));
+            pfvf r = pfv_mul(a, pfv_sub(pfv_set(PF_PI_4),
+                                        pfv_mul(pfv_sub(a, one),
+                                                pfv_set(0.2733185f))));
+            pfvf sel = pfv_gt(absy, absx);
+            r = pfv_or(pfv_and(sel, pfv_sub(pfv_set(1.57079637f), r)),
+                       pfv_andnot(sel, r));
+            sel = pfv_lt(dx, pfv_set(0.0f));
+            r = pfv_or(pfv_and(sel, pfv_sub(pfv_set(3.14159274f), r)),
+                       pfv_andnot(sel, r));
+            r = pfv_xor(r, pfv_and(signbit, dy));
+            pfvi li = pfv_trunc(pfv_add(half, pfv_mul(pfv_set(PF_BUCKET_SCALE),
+                                                     pfv_add(r, pfv_set(PF_PI)))));
+
+            pfvf c = pfv_mul(pfv_sub(inlierplus1, absdr),
+                             pfv_set(PF_INV_INLIER_PAR));
+            sel = pfv_lt(absdr, one);
+            c = pfv_or(pfv_and(sel, one), pfv_andnot(sel, c));
+
+            pfv_store(vcval, c);
+            pfv_store(vbucket, li);
+            int inliermask = pfv_mask(inlier);
+
+            //padding lanes are never near
+            while(nearmask) {
+                int k = __builtin_ctz(nearmask);
+                nearmask &= nearmask - 1;
+                bucket[m] = (inliermask >> k) & 1 ? vbucket[k] : -1;
+                cval[m] = vcval[k];
+                m++;
+            }
+        }
+
+        float L[PF_ANG_BUCKETS] = {0};
+        float l = PF_MIN_LIKE;
+        float score = 0.0f;
+        float negativescaler = (float)PF_NEG_BIAS_CONSTANT / (p.r * p.r);
+
+        for(unsigned int j = 0; j < m; j++) {
+            int b = bucket[j];
+            if(b < 0) {
+                score -= negativescaler;
+            } else if(cval[j] > L[b]) {
+                score = (score + cval[j]) - L[b];
+                L[b] = cval[j];
+                if(score > l) l = score;
+            }
+        }
+
+        return l;
+#endif
+    }
+
+};
+
+#endif
@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+"""Writes pf_polar_lut.h: the distance and angular bucket of every offset
+(dx, dy) within MAX_RADIUS_PLUS2 of a particle, on a grid of 1 / sub pixels,
+packed in one word.
+
+    python make_polar_lut.py [sub] > pf_polar_lut.h
+
+the checked in table is for whole pixels (sub = 1, 29 KB): at half pixels it
+is four times the size and tracks no better. make in pf_spinn writes it again
+when this script is newer; the host build uses the checked in copy.
+"""
+
+import math
+import sys
+
+MAX_RADIUS_PLUS2 = 42
+ANG_BUCKETS = 64
+BUCKET_SCALE = 10.026769884  # as calculate_likelihood: (ANG_BUCKETS - 1) / 2 pi
+DIST_FRAC_BITS = 15          # the distance as the bits of an accum (s16.15)
+BUCKET_SHIFT = 24
+
+PER_LINE = 6
+
+
+def entry(dx, dy):
+    d = int(round(math.sqrt(dx * dx + dy * dy) * (1 << DIST_FRAC_BITS)))
+    b = int(0.5 + BUCKET_SCALE * (math.atan2(dy, dx) + math.pi))
+    return (b << BUCKET_SHIFT) | d
+
+
+def main():
+    sub = int(sys.argv[1]) if len(sys.argv) > 1 else 1
+    half = MAX_RADIUS_PLUS2 * sub
+    suffix = "" if sub == 1 else str(sub)
+    print("""
+//! generated by make_polar_lut.py %(args)s. do not edit
+//!
+//! the distance and angular bucket of every offset (dx, dy) of an event from
+//! a particle, in steps of 1 / PF_POLAR_SUB pixels up to PF_POLAR_RANGE
+//! pixels, in one word: the bucket (of ANG_BUCKETS, from atan2) in the top
+//! byte and the distance as the bits of an s16.15 accum in the rest. index
+//! it with PF_POLAR_INDEX(dx * PF_POLAR_SUB, dy * PF_POLAR_SUB).
+//!
+//! the table is not const on SpiNNaker (define PF_POLAR_LUT_CONST as empty)
+//! so that it is loaded into DTCM with the other data.
+
+#ifndef __PF_POLAR_LUT%(suffix)s_H__
+#define __PF_POLAR_LUT%(suffix)s_H__
+
+#include <stdint.h>
+
+#ifndef PF_POLAR_LUT_CONST
+#define PF_POLAR_LUT_CONST const
+#endif
+
+#define PF_POLAR_RANGE %(range)d
+#define PF_POLAR_SUB %(sub)d
+#define PF_POLAR_HALF %(half)d
+#define PF_POLAR_SIZE %(size)d
+#define PF_POLAR_INDEX(dx, dy) \\
+    (((dy) + PF_POLAR_HALF) * PF_POLAR_SIZE + (dx) + PF_POLAR_HALF)
+#define PF_POLAR_DIST_BITS(e) ((e) & 0x00FFFFFF)
+#define PF_POLAR_BUCKET(e) ((e) >> %(shift)d)
+""" % {"args": " ".join(sys.argv[1:]), "suffix": suffix,
+       "range": MAX_RADIUS_PLUS2, "sub": sub, "half": half,
+       "size": 2 * half + 1, "shift": BUCKET_SHIFT})
+
+    print("static PF_POLAR_LUT_CONST uint32_t pf_polar_lut[PF_POLAR_SIZE * "
+          "PF_POLAR_SIZE] = {")
+    values = [entry(float(dx) / sub, float(dy) / sub)
+              for dy in range(-half, half + 1)
+              for dx in range(-half, half + 1)]
+    for i in range(0, len(values), PER_LINE):
+        line = ", ".join("0x%08x" % v for v in values[i:i + PER_LINE])
+        print("    " + line + ("," if i + PER_LINE < len(values) else ""))
+    print("};")
+    print("")
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
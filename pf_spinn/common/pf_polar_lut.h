@@ -0,0 +1,1239 @@
+
+//! generated by make_polar_lut.py . do not edit
+//!
+//! the distance and angular bucket of every offset (dx, dy) of an event from
+//! a particle, in steps of 1 / PF_POLAR_SUB pixels up to PF_POLAR_RANGE
+//! pixels, in one word: the bucket (of ANG_BUCKETS, from atan2) in the top
+//! byte and the distance as the bits of an s16.15 accum in the rest. index
+//! it with PF_POLAR_INDEX(dx * PF_POLAR_SUB, dy * PF_POLAR_SUB).
+//!
+//! the table is not const on SpiNNaker (define PF_POLAR_LUT_CONST as empty)
+//! so that it is loaded into DTCM with the other data.
+
+#ifndef __PF_POLAR_LUT_H__
+#define __PF_POLAR_LUT_H__
+
+#include <stdint.h>
+
+#ifndef PF_POLAR_LUT_CONST
+#define PF_POLAR_LUT_CONST const
+#endif
+
+#define PF_POLAR_RANGE 42
+#define PF_POLAR_SUB 1
+#define PF_POLAR_HALF 42
+#define PF_POLAR_SIZE 85
+#define PF_POLAR_INDEX(dx, dy) \
+    (((dy) + PF_POLAR_HALF) * PF_POLAR_SIZE + (dx) + PF_POLAR_HALF)
+#define PF_POLAR_DIST_BITS(e) ((e) & 0x00FFFFFF)
+#define PF_POLAR_BUCKET(e) ((e) >> 24)
+
+static PF_POLAR_LUT_CONST uint32_t pf_polar_lut[PF_POLAR_SIZE * PF_POLAR_SIZE] = {
+    0x081db2d0, 0x081d58d9, 0x081d0000, 0x081ca84f, 0x081c51d2, 0x091bfc92,
+    0x091ba89c, 0x091b55fc, 0x091b04bd, 0x091ab4ed, 0x091a6698, 0x091a19cc,
+    0x0a19ce96, 0x0a198505, 0x0a193d26, 0x0a18f709, 0x0a18b2bc, 0x0a18704f,
+    0x0b182fd0, 0x0b17f151, 0x0b17b4e0, 0x0b177a8d, 0x0b174268, 0x0b170c82,
+    0x0c16d8ea, 0x0c16a7af, 0x0c1678e2, 0x0c164c92, 0x0d1622cd, 0x0d15fba2,
+    0x0d15d720, 0x0d15b553, 0x0d159648, 0x0e157a0b, 0x0e1560a8, 0x0e154a28,
+    0x0e153695, 0x0f1525f6, 0x0f151853, 0x0f150db2, 0x0f150617, 0x10150186,
+    0x10150000, 0x10150186, 0x10150617, 0x10150db2, 0x11151853, 0x111525f6,
+    0x11153695, 0x11154a28, 0x121560a8, 0x12157a0b, 0x12159648, 0x1215b553,
+    0x1315d720, 0x1315fba2, 0x131622cd, 0x13164c92, 0x131678e2, 0x1416a7af,
+    0x1416d8ea, 0x14170c82, 0x14174268, 0x14177a8d, 0x1517b4e0, 0x1517f151,
+    0x15182fd0, 0x1518704f, 0x1518b2bc, 0x1518f709, 0x16193d26, 0x16198505,
+    0x1619ce96, 0x161a19cc, 0x161a6698, 0x161ab4ed, 0x171b04bd, 0x171b55fc,
+    0x171ba89c, 0x171bfc92, 0x171c51d2, 0x171ca84f, 0x171d0000, 0x181d58d9,
+    0x181db2d0, 0x081d58d9, 0x081cfdcb, 0x081ca3d7, 0x081c4b09, 0x081bf36b,
+    0x081b9d08, 0x091b47ec, 0x091af423, 0x091aa1ba, 0x091a50be, 0x091a013b,
+    0x0919b340, 0x091966db, 0x0a191c19, 0x0a18d30b, 0x0a188bbe, 0x0a184644,
+    0x0a1802ab, 0x0a17c103, 0x0b17815d, 0x0b1743c9, 0x0b170858, 0x0b16cf1a,
+    0x0b169821, 0x0c16637c, 0x0c16313d, 0x0c160174, 0x0c15d431, 0x0c15a985,
+    0x0d15817d, 0x0d155c2a, 0x0d153999, 0x0d1519d8, 0x0e14fcf4, 0x0e14e2f8,
+    0x0e14cbf0, 0x0e14b7e6, 0x0f14a6e1, 0x0f1498eb, 0x0f148e08, 0x0f14863d,
+    0x10148190, 0x10148000, 0x10148190, 0x1014863d, 0x10148e08, 0x111498eb,
+    0x1114a6e1, 0x1114b7e6, 0x1114cbf0, 0x1214e2f8, 0x1214fcf4, 0x121519d8,
+    0x12153999, 0x13155c2a, 0x1315817d, 0x1315a985, 0x1315d431, 0x13160174,
+    0x1416313d, 0x1416637c, 0x14169821, 0x1416cf1a, 0x14170858, 0x151743c9,
+    0x1517815d, 0x1517c103, 0x151802ab, 0x15184644, 0x16188bbe, 0x1618d30b,
+    0x16191c19, 0x161966db, 0x1619b340, 0x161a013b, 0x171a50be, 0x171aa1ba,
+    0x171af423, 0x171b47ec, 0x171b9d08, 0x171bf36b, 0x171c4b09, 0x181ca3d7,
+    0x181cfdcb, 0x181d58d9, 0x081d0000, 0x081ca3d7, 0x081c48c6, 0x081beed6,
+    0x081b9613, 0x081b3e88, 0x081ae841, 0x091a934b, 0x091a3fb2, 0x0919ed83,
+    0x09199ccd, 0x09194d9c, 0x09190000, 0x0918b407, 0x0a1869c2, 0x0a18213e,
+    0x0a17da8d, 0x0a1795bf, 0x0a1752e5, 0x0b17120f, 0x0b16d34f, 0x0b1696b6,
+    0x0b165c56, 0x0b16243f, 0x0c15ee85, 0x0c15bb37, 0x0c158a69, 0x0c155c2a,
+    0x0c15308b, 0x0d15079d, 0x0d14e170, 0x0d14be12, 0x0d149d93, 0x0e148000,
+    0x0e146565, 0x0e144dcf, 0x0e143948, 0x0f1427d8, 0x0f141989, 0x0f140e61,
+    0x0f140665, 0x0f14019a, 0x10140000, 0x1014019a, 0x10140665, 0x11140e61,
+    0x11141989, 0x111427d8, 0x11143948, 0x11144dcf, 0x12146565, 0x12148000,
+    0x12149d93, 0x1214be12, 0x1314e170, 0x1315079d, 0x1315308b, 0x13155c2a,
+    0x14158a69, 0x1415bb37, 0x1415ee85, 0x1416243f, 0x14165c56, 0x151696b6,
+    0x1516d34f, 0x1517120f, 0x151752e5, 0x151795bf, 0x1617da8d, 0x1618213e,
+    0x161869c2, 0x1618b407, 0x16190000, 0x16194d9c, 0x17199ccd, 0x1719ed83,
+    0x171a3fb2, 0x171a934b, 0x171ae841, 0x171b3e88, 0x171b9613, 0x171beed6,
+    0x181c48c6, 0x181ca3d7, 0x181d0000, 0x081ca84f, 0x081c4b09, 0x081beed6,
+    0x081b93c1, 0x081b39d5, 0x081ae11e, 0x081a89a7, 0x081a337e, 0x0919deb0,
+    0x09198b49, 0x09193958, 0x0918e8eb, 0x09189a11, 0x09184cda, 0x0a180155,
+    0x0a17b793, 0x0a176fa3, 0x0a172998, 0x0a16e581, 0x0a16a372, 0x0b16637c,
+    0x0b1625b1, 0x0b15ea24, 0x0b15b0e6, 0x0b157a0b, 0x0c1545a5, 0x0c1513c6,
+    0x0c14e480, 0x0c14b7e6, 0x0d148e08, 0x0d1466f7, 0x0d1442c4, 0x0d14217e,
+    0x0d140333, 0x0e13e7f2, 0x0e13cfc6, 0x0e13babb, 0x0e13a8dc, 0x0f139a30,
+    0x0f138ebf, 0x0f13868f, 0x0f1381a4, 0x10138000, 0x101381a4, 0x1013868f,
+    0x11138ebf, 0x11139a30, 0x1113a8dc, 0x1113babb, 0x1213cfc6, 0x1213e7f2,
+    0x12140333, 0x1214217e, 0x131442c4, 0x131466f7, 0x13148e08, 0x1314b7e6,
+    0x1314e480, 0x141513c6, 0x141545a5, 0x14157a0b, 0x1415b0e6, 0x1515ea24,
+    0x151625b1, 0x1516637c, 0x1516a372, 0x1516e581, 0x15172998, 0x16176fa3,
+    0x1617b793, 0x16180155, 0x16184cda, 0x16189a11, 0x1618e8eb, 0x17193958,
+    0x17198b49, 0x1719deb0, 0x171a337e, 0x171a89a7, 0x171ae11e, 0x171b39d5,
+    0x181b93c1, 0x181beed6, 0x181c4b09, 0x181ca84f, 0x071c51d2, 0x071bf36b,
+    0x081b9613, 0x081b39d5, 0x081adebc, 0x081a84d4, 0x081a2c29, 0x0819d4c8,
+    0x08197ebf, 0x09192a1a, 0x0918d6e8, 0x09188539, 0x0918351b, 0x0917e69d,
+    0x091799d1, 0x0a174ec7, 0x0a170590, 0x0a16be3e, 0x0a1678e2, 0x0a163590,
+    0x0a15f45a, 0x0b15b553, 0x0b15788e, 0x0b153e1e, 0x0b150617, 0x0c14d08d,
+    0x0c149d93, 0x0c146d3c, 0x0c143f9b, 0x0c1414c2, 0x0d13ecc4, 0x0d13c7b1,
+    0x0d13a59a, 0x0d13868f, 0x0e136a9f, 0x0e1351d6, 0x0e133c42, 0x0e1329ed,
+    0x0f131ae0, 0x0f130f22, 0x0f1306bb, 0x0f1301af, 0x10130000, 0x101301af,
+    0x101306bb, 0x11130f22, 0x11131ae0, 0x111329ed, 0x11133c42, 0x121351d6,
+    0x12136a9f, 0x1213868f, 0x1213a59a, 0x1313c7b1, 0x1313ecc4, 0x131414c2,
+    0x13143f9b, 0x14146d3c, 0x14149d93, 0x1414d08d, 0x14150617, 0x14153e1e,
+    0x1515788e, 0x1515b553, 0x1515f45a, 0x15163590, 0x151678e2, 0x1616be3e,
+    0x16170590, 0x16174ec7, 0x161799d1, 0x1617e69d, 0x1618351b, 0x17188539,
+    0x1718d6e8, 0x17192a1a, 0x17197ebf, 0x1719d4c8, 0x171a2c29, 0x171a84d4,
+    0x181adebc, 0x181b39d5, 0x181b9613, 0x181bf36b, 0x181c51d2, 0x071bfc92,
+    0x071b9d08, 0x071b3e88, 0x081ae11e, 0x081a84d4, 0x081a29b7, 0x0819cfd3,
+    0x08197736, 0x08191fec, 0x0818ca03, 0x0918758b, 0x09182292, 0x0917d128,
+    0x0917815d, 0x09173341, 0x0916e6e7, 0x0a169c60, 0x0a1653be, 0x0a160d13,
+    0x0a15c874, 0x0a1585f3, 0x0b1545a5, 0x0b15079d, 0x0b14cbf0, 0x0b1492b3,
+    0x0b145bf9, 0x0c1427d8, 0x0c13f664, 0x0c13c7b1, 0x0c139bd2, 0x0d1372db,
+    0x0d134cde, 0x0d1329ed, 0x0d130a18, 0x0e12ed70, 0x0e12d403, 0x0e12bdde,
+    0x0e12ab0c, 0x0f129b98, 0x0f128f8b, 0x0f1286ea, 0x0f1281bb, 0x10128000,
+    0x101281bb, 0x101286ea, 0x11128f8b, 0x11129b98, 0x1112ab0c, 0x1112bdde,
+    0x1212d403, 0x1212ed70, 0x12130a18, 0x121329ed, 0x13134cde, 0x131372db,
+    0x13139bd2, 0x1313c7b1, 0x1413f664, 0x141427d8, 0x14145bf9, 0x141492b3,
+    0x1514cbf0, 0x1515079d, 0x151545a5, 0x151585f3, 0x1515c874, 0x16160d13,
+    0x161653be, 0x16169c60, 0x1616e6e7, 0x16173341, 0x1617815d, 0x1717d128,
+    0x17182292, 0x1718758b, 0x1718ca03, 0x17191fec, 0x17197736, 0x1719cfd3,
+    0x181a29b7, 0x181a84d4, 0x181ae11e, 0x181b3e88, 0x181b9d08, 0x181bfc92,
+    0x071ba89c, 0x071b47ec, 0x071ae841, 0x071a89a7, 0x081a2c29, 0x0819cfd3,
+    0x081974b2, 0x08191ad3, 0x0818c243, 0x08186b11, 0x0818154c, 0x0917c103,
+    0x09176e46, 0x09171d25, 0x0916cdb3, 0x09168000, 0x0916341f, 0x0a15ea24,
+    0x0a15a220, 0x0a155c2a, 0x0a151853, 0x0a14d6b3, 0x0b14975d, 0x0b145a67,
+    0x0b141fe7, 0x0b13e7f2, 0x0c13b29d, 0x0c138000, 0x0c13502e, 0x0c13233e,
+    0x0d12f942, 0x0d12d250, 0x0d12ae7a, 0x0d128dd1, 0x0e127068, 0x0e12564e,
+    0x0e123f90, 0x0e122c3b, 0x0f121c5b, 0x0f120ff9, 0x0f12071b, 0x0f1201c7,
+    0x10120000, 0x101201c7, 0x1012071b, 0x11120ff9, 0x11121c5b, 0x11122c3b,
+    0x11123f90, 0x1212564e, 0x12127068, 0x12128dd1, 0x1212ae7a, 0x1312d250,
+    0x1312f942, 0x1313233e, 0x1313502e, 0x14138000, 0x1413b29d, 0x1413e7f2,
+    0x14141fe7, 0x15145a67, 0x1514975d, 0x1514d6b3, 0x15151853, 0x15155c2a,
+    0x1615a220, 0x1615ea24, 0x1616341f, 0x16168000, 0x1616cdb3, 0x17171d25,
+    0x17176e46, 0x1717c103, 0x1718154c, 0x17186b11, 0x1718c243, 0x17191ad3,
+    0x181974b2, 0x1819cfd3, 0x181a2c29, 0x181a89a7, 0x181ae841, 0x181b47ec,
+    0x181ba89c, 0x071b55fc, 0x071af423, 0x071a934b, 0x071a337e, 0x0719d4c8,
+    0x08197736, 0x08191ad3, 0x0818bfad, 0x081865d3, 0x08180d52, 0x0817b639,
+    0x08176099, 0x09170c82, 0x0916ba05, 0x09166933, 0x09161a1f, 0x0915ccdc,
+    0x0a15817d, 0x0a153817, 0x0a14f0be, 0x0a14ab87, 0x0a146888, 0x0b1427d8,
+    0x0b13e98d, 0x0b13adbd, 0x0b137480, 0x0b133dec, 0x0c130a18, 0x0c12d91c,
+    0x0c12ab0c, 0x0c128000, 0x0d12580c, 0x0d123345, 0x0d1211be, 0x0d11f38a,
+    0x0e11d8b9, 0x0e11c15a, 0x0e11ad7c, 0x0f119d2a, 0x0f11906d, 0x0f11874f,
+    0x0f1181d4, 0x10118000, 0x101181d4, 0x1011874f, 0x1111906d, 0x11119d2a,
+    0x1111ad7c, 0x1111c15a, 0x1211d8b9, 0x1211f38a, 0x121211be, 0x13123345,
+    0x1312580c, 0x13128000, 0x1312ab0c, 0x1412d91c, 0x14130a18, 0x14133dec,
+    0x14137480, 0x1513adbd, 0x1513e98d, 0x151427d8, 0x15146888, 0x1514ab87,
+    0x1614f0be, 0x16153817, 0x1615817d, 0x1615ccdc, 0x16161a1f, 0x17166933,
+    0x1716ba05, 0x17170c82, 0x17176099, 0x1717b639, 0x17180d52, 0x171865d3,
+    0x1818bfad, 0x18191ad3, 0x18197736, 0x1819d4c8, 0x181a337e, 0x181a934b,
+    0x181af423, 0x191b55fc, 0x071b04bd, 0x071aa1ba, 0x071a3fb2, 0x0719deb0,
+    0x07197ebf, 0x07191fec, 0x0818c243, 0x081865d3, 0x08180aa8, 0x0817b0d3,
+    0x08175861, 0x08170164, 0x0916abec, 0x0916580a, 0x091605d1, 0x0915b553,
+    0x091566a4, 0x091519d8, 0x0a14cf04, 0x0a14863d, 0x0a143f9b, 0x0a13fb33,
+    0x0a13b91c, 0x0b13796e, 0x0b133c42, 0x0b1301af, 0x0b12c9ce, 0x0c1294b6,
+    0x0c126281, 0x0c123345, 0x0c12071b, 0x0d11de19, 0x0d11b855, 0x0d1195e4,
+    0x0d1176d9, 0x0e115b47, 0x0e11433f, 0x0e112ecf, 0x0f111e04, 0x0f1110e9,
+    0x0f110786, 0x0f1101e2, 0x10110000, 0x101101e2, 0x10110786, 0x111110e9,
+    0x11111e04, 0x11112ecf, 0x1211433f, 0x12115b47, 0x121176d9, 0x121195e4,
+    0x1311b855, 0x1311de19, 0x1312071b, 0x13123345, 0x14126281, 0x141294b6,
+    0x1412c9ce, 0x141301af, 0x15133c42, 0x1513796e, 0x1513b91c, 0x1513fb33,
+    0x16143f9b, 0x1614863d, 0x1614cf04, 0x161519d8, 0x161566a4, 0x1615b553,
+    0x171605d1, 0x1716580a, 0x1716abec, 0x17170164, 0x17175861, 0x1717b0d3,
+    0x18180aa8, 0x181865d3, 0x1818c243, 0x18191fec, 0x18197ebf, 0x1819deb0,
+    0x181a3fb2, 0x191aa1ba, 0x191b04bd, 0x071ab4ed, 0x071a50be, 0x0719ed83,
+    0x07198b49, 0x07192a1a, 0x0718ca03, 0x07186b11, 0x08180d52, 0x0817b0d3,
+    0x081755a3, 0x0816fbd3, 0x0816a372, 0x08164c92, 0x0915f744, 0x0915a39b,
+    0x091551aa, 0x09150186, 0x0914b343, 0x091466f7, 0x0a141cb8, 0x0a13d49e,
+    0x0a138ebf, 0x0a134b35, 0x0b130a18, 0x0b12cb82, 0x0b128f8b, 0x0b12564e,
+    0x0b121fe4, 0x0c11ec67, 0x0c11bbf1, 0x0c118e9b, 0x0d11647d, 0x0d113dae,
+    0x0d111a46, 0x0d10fa59, 0x0e10ddfc, 0x0e10c540, 0x0e10b036, 0x0f109eeb,
+    0x0f10916b, 0x0f1087c0, 0x0f1081f0, 0x10108000, 0x101081f0, 0x101087c0,
+    0x1110916b, 0x11109eeb, 0x1110b036, 0x1210c540, 0x1210ddfc, 0x1210fa59,
+    0x12111a46, 0x13113dae, 0x1311647d, 0x13118e9b, 0x1411bbf1, 0x1411ec67,
+    0x14121fe4, 0x1412564e, 0x15128f8b, 0x1512cb82, 0x15130a18, 0x15134b35,
+    0x15138ebf, 0x1613d49e, 0x16141cb8, 0x161466f7, 0x1614b343, 0x16150186,
+    0x171551aa, 0x1715a39b, 0x1715f744, 0x17164c92, 0x1716a372, 0x1716fbd3,
+    0x181755a3, 0x1817b0d3, 0x18180d52, 0x18186b11, 0x1818ca03, 0x18192a1a,
+    0x18198b49, 0x1919ed83, 0x191a50be, 0x191ab4ed, 0x071a6698, 0x071a013b,
+    0x07199ccd, 0x07193958, 0x0718d6e8, 0x0718758b, 0x0718154c, 0x0717b639,
+    0x08175861, 0x0816fbd3, 0x0816a09e, 0x081646d4, 0x0815ee85, 0x081597c3,
+    0x091542a2, 0x0914ef36, 0x09149d93, 0x09144dcf, 0x09140000, 0x0a13b43d,
+    0x0a136a9f, 0x0a13233e, 0x0a12de33, 0x0a129b98, 0x0b125b89, 0x0b121e20,
+    0x0b11e378, 0x0b11abac, 0x0c1176d9, 0x0c114519, 0x0c111688, 0x0c10eb3f,
+    0x0d10c358, 0x0d109eeb, 0x0d107e0f, 0x0e1060db, 0x0e104761, 0x0e1031b3,
+    0x0f101fe0, 0x0f1011f6, 0x0f1007fe, 0x0f100200, 0x10100000, 0x10100200,
+    0x101007fe, 0x111011f6, 0x11101fe0, 0x111031b3, 0x12104761, 0x121060db,
+    0x12107e0f, 0x12109eeb, 0x1310c358, 0x1310eb3f, 0x13111688, 0x14114519,
+    0x141176d9, 0x1411abac, 0x1411e378, 0x15121e20, 0x15125b89, 0x15129b98,
+    0x1512de33, 0x1613233e, 0x16136a9f, 0x1613b43d, 0x16140000, 0x16144dcf,
+    0x17149d93, 0x1714ef36, 0x171542a2, 0x171597c3, 0x1715ee85, 0x171646d4,
+    0x1816a09e, 0x1816fbd3, 0x18175861, 0x1817b639, 0x1818154c, 0x1818758b,
+    0x1818d6e8, 0x19193958, 0x19199ccd, 0x191a013b, 0x191a6698, 0x061a19cc,
+    0x0619b340, 0x07194d9c, 0x0718e8eb, 0x07188539, 0x07182292, 0x0717c103,
+    0x07176099, 0x07170164, 0x0816a372, 0x081646d4, 0x0815eb99, 0x081591d5,
+    0x08153999, 0x0814e2f8, 0x09148e08, 0x09143add, 0x0913e98d, 0x09139a30,
+    0x09134cde, 0x0a1301af, 0x0a12b8be, 0x0a127224, 0x0a122dfe, 0x0a11ec67,
+    0x0b11ad7c, 0x0b117159, 0x0b11381c, 0x0b1101e2, 0x0c10cec8, 0x0c109eeb,
+    0x0c107267, 0x0d104958, 0x0d1023d8, 0x0d100200, 0x0e0fe3e7, 0x0e0fc9a4,
+    0x0e0fb348, 0x0e0fa0e5, 0x0f0f928a, 0x0f0f8840, 0x0f0f8210, 0x100f8000,
+    0x100f8210, 0x100f8840, 0x110f928a, 0x110fa0e5, 0x110fb348, 0x120fc9a4,
+    0x120fe3e7, 0x12100200, 0x131023d8, 0x13104958, 0x13107267, 0x13109eeb,
+    0x1410cec8, 0x141101e2, 0x1411381c, 0x15117159, 0x1511ad7c, 0x1511ec67,
+    0x15122dfe, 0x15127224, 0x1612b8be, 0x161301af, 0x16134cde, 0x16139a30,
+    0x1713e98d, 0x17143add, 0x17148e08, 0x1714e2f8, 0x17153999, 0x171591d5,
+    0x1815eb99, 0x181646d4, 0x1816a372, 0x18170164, 0x18176099, 0x1817c103,
+    0x19182292, 0x19188539, 0x1918e8eb, 0x19194d9c, 0x1919b340, 0x191a19cc,
+    0x0619ce96, 0x061966db, 0x06190000, 0x07189a11, 0x0718351b, 0x0717d128,
+    0x07176e46, 0x07170c82, 0x0716abec, 0x07164c92, 0x0815ee85, 0x081591d5,
+    0x08153695, 0x0814dcd6, 0x081484ae, 0x08142e31, 0x0913d974, 0x0913868f,
+    0x09133599, 0x0912e6ac, 0x091299e0, 0x0a124f51, 0x0a12071b, 0x0a11c15a,
+    0x0a117e2c, 0x0b113dae, 0x0b110000, 0x0b10c540, 0x0b108d8e, 0x0c105908,
+    0x0c1027ce, 0x0c0ff9ff, 0x0d0fcfb7, 0x0d0fa914, 0x0d0f8630, 0x0d0f6726,
+    0x0e0f4c0c, 0x0e0f34f8, 0x0e0f21fc, 0x0f0f1327, 0x0f0f0886, 0x0f0f0222,
+    0x100f0000, 0x100f0222, 0x100f0886, 0x110f1327, 0x110f21fc, 0x110f34f8,
+    0x120f4c0c, 0x120f6726, 0x120f8630, 0x130fa914, 0x130fcfb7, 0x130ff9ff,
+    0x141027ce, 0x14105908, 0x14108d8e, 0x1410c540, 0x15110000, 0x15113dae,
+    0x15117e2c, 0x1511c15a, 0x1612071b, 0x16124f51, 0x161299e0, 0x1612e6ac,
+    0x17133599, 0x1713868f, 0x1713d974, 0x17142e31, 0x171484ae, 0x1714dcd6,
+    0x18153695, 0x181591d5, 0x1815ee85, 0x18164c92, 0x1816abec, 0x18170c82,
+    0x19176e46, 0x1917d128, 0x1918351b, 0x19189a11, 0x19190000, 0x191966db,
+    0x1919ce96, 0x06198505, 0x06191c19, 0x0618b407, 0x06184cda, 0x0717e69d,
+    0x0717815d, 0x07171d25, 0x0716ba05, 0x0716580a, 0x0715f744, 0x071597c3,
+    0x08153999, 0x0814dcd6, 0x08148190, 0x081427d8, 0x0813cfc6, 0x0813796e,
+    0x091324ea, 0x0912d250, 0x091281bb, 0x09123345, 0x0911e70b, 0x0a119d2a,
+    0x0a1155be, 0x0a1110e9, 0x0a10cec8, 0x0b108f7d, 0x0b105328, 0x0b1019eb,
+    0x0c0fe3e7, 0x0c0fb13e, 0x0c0f8210, 0x0c0f567e, 0x0d0f2ea6, 0x0d0f0aa7,
+    0x0d0eea9b, 0x0e0ece9e, 0x0e0eb6c5, 0x0e0ea325, 0x0f0e93cf, 0x0f0e88d1,
+    0x0f0e8235, 0x100e8000, 0x100e8235, 0x100e88d1, 0x110e93cf, 0x110ea325,
+    0x110eb6c5, 0x120ece9e, 0x120eea9b, 0x120f0aa7, 0x130f2ea6, 0x130f567e,
+    0x130f8210, 0x140fb13e, 0x140fe3e7, 0x141019eb, 0x15105328, 0x15108f7d,
+    0x1510cec8, 0x151110e9, 0x161155be, 0x16119d2a, 0x1611e70b, 0x16123345,
+    0x161281bb, 0x1712d250, 0x171324ea, 0x1713796e, 0x1713cfc6, 0x171427d8,
+    0x18148190, 0x1814dcd6, 0x18153999, 0x181597c3, 0x1815f744, 0x1816580a,
+    0x1916ba05, 0x19171d25, 0x1917815d, 0x1917e69d, 0x19184cda, 0x1918b407,
+    0x19191c19, 0x19198505, 0x06193d26, 0x0618d30b, 0x061869c2, 0x06180155,
+    0x061799d1, 0x06173341, 0x0716cdb3, 0x07166933, 0x071605d1, 0x0715a39b,
+    0x071542a2, 0x0714e2f8, 0x081484ae, 0x081427d8, 0x0813cc8b, 0x081372db,
+    0x08131ae0, 0x0812c4b1, 0x09127068, 0x09121e20, 0x0911cdf3, 0x09118000,
+    0x0a113464, 0x0a10eb3f, 0x0a10a4b0, 0x0a1060db, 0x0b101fe0, 0x0b0fe1e4,
+    0x0b0fa709, 0x0b0f6f73, 0x0c0f3b47, 0x0c0f0aa7, 0x0c0eddb7, 0x0d0eb498,
+    0x0d0e8f6b, 0x0d0e6e4d, 0x0e0e515d, 0x0e0e38b2, 0x0e0e2463, 0x0f0e1483,
+    0x0f0e0922, 0x0f0e0249, 0x100e0000, 0x100e0249, 0x100e0922, 0x110e1483,
+    0x110e2463, 0x120e38b2, 0x120e515d, 0x120e6e4d, 0x130e8f6b, 0x130eb498,
+    0x130eddb7, 0x140f0aa7, 0x140f3b47, 0x140f6f73, 0x140fa709, 0x150fe1e4,
+    0x15101fe0, 0x151060db, 0x1510a4b0, 0x1610eb3f, 0x16113464, 0x16118000,
+    0x1611cdf3, 0x17121e20, 0x17127068, 0x1712c4b1, 0x17131ae0, 0x171372db,
+    0x1813cc8b, 0x181427d8, 0x181484ae, 0x1814e2f8, 0x181542a2, 0x1815a39b,
+    0x191605d1, 0x19166933, 0x1916cdb3, 0x19173341, 0x191799d1, 0x19180155,
+    0x191869c2, 0x1918d30b, 0x1a193d26, 0x0618f709, 0x06188bbe, 0x0618213e,
+    0x0617b793, 0x06174ec7, 0x0616e6e7, 0x06168000, 0x07161a1f, 0x0715b553,
+    0x071551aa, 0x0714ef36, 0x07148e08, 0x07142e31, 0x0813cfc6, 0x081372db,
+    0x08131786, 0x0812bdde, 0x081265fc, 0x08120ff9, 0x0911bbf1, 0x09116a01,
+    0x09111a46, 0x0910cce0, 0x0a1081f0, 0x0a103998, 0x0a0ff3fb, 0x0a0fb13e,
+    0x0b0f7186, 0x0b0f34f8, 0x0b0efbbb, 0x0c0ec5f6, 0x0c0e93cf, 0x0c0e656c,
+    0x0d0e3af2, 0x0d0e1483, 0x0d0df242, 0x0e0dd44e, 0x0e0dbac2, 0x0e0da5b8,
+    0x0f0d9545, 0x0f0d8978, 0x0f0d825f, 0x100d8000, 0x100d825f, 0x100d8978,
+    0x110d9545, 0x110da5b8, 0x120dbac2, 0x120dd44e, 0x120df242, 0x130e1483,
+    0x130e3af2, 0x130e656c, 0x140e93cf, 0x140ec5f6, 0x140efbbb, 0x150f34f8,
+    0x150f7186, 0x150fb13e, 0x150ff3fb, 0x16103998, 0x161081f0, 0x1610cce0,
+    0x16111a46, 0x17116a01, 0x1711bbf1, 0x17120ff9, 0x171265fc, 0x1712bdde,
+    0x18131786, 0x181372db, 0x1813cfc6, 0x18142e31, 0x18148e08, 0x1814ef36,
+    0x191551aa, 0x1915b553, 0x19161a1f, 0x19168000, 0x1916e6e7, 0x19174ec7,
+    0x1917b793, 0x1a18213e, 0x1a188bbe, 0x1a18f709, 0x0618b2bc, 0x06184644,
+    0x0617da8d, 0x06176fa3, 0x06170590, 0x06169c60, 0x0616341f, 0x0615ccdc,
+    0x071566a4, 0x07150186, 0x07149d93, 0x07143add, 0x0713d974, 0x0713796e,
+    0x08131ae0, 0x0812bdde, 0x08126281, 0x081208e1, 0x0811b11a, 0x08115b47,
+    0x09110786, 0x0910b5f5, 0x091066b6, 0x091019eb, 0x0a0fcfb7, 0x0a0f8840,
+    0x0a0f43ac, 0x0b0f0222, 0x0b0ec3cb, 0x0b0e88d1, 0x0b0e515d, 0x0c0e1d98,
+    0x0c0dedab, 0x0c0dc1bf, 0x0d0d99fa, 0x0d0d7681, 0x0d0d5777, 0x0e0d3cfb,
+    0x0e0d2727, 0x0f0d1615, 0x0f0d09d5, 0x0f0d0276, 0x100d0000, 0x100d0276,
+    0x110d09d5, 0x110d1615, 0x110d2727, 0x120d3cfb, 0x120d5777, 0x120d7681,
+    0x130d99fa, 0x130dc1bf, 0x130dedab, 0x140e1d98, 0x140e515d, 0x140e88d1,
+    0x150ec3cb, 0x150f0222, 0x150f43ac, 0x160f8840, 0x160fcfb7, 0x161019eb,
+    0x161066b6, 0x1710b5f5, 0x17110786, 0x17115b47, 0x1711b11a, 0x171208e1,
+    0x18126281, 0x1812bdde, 0x18131ae0, 0x1813796e, 0x1813d974, 0x19143add,
+    0x19149d93, 0x19150186, 0x191566a4, 0x1915ccdc, 0x1916341f, 0x19169c60,
+    0x19170590, 0x1a176fa3, 0x1a17da8d, 0x1a184644, 0x1a18b2bc, 0x0518704f,
+    0x051802ab, 0x061795bf, 0x06172998, 0x0616be3e, 0x061653be, 0x0615ea24,
+    0x0615817d, 0x061519d8, 0x0714b343, 0x07144dcf, 0x0713e98d, 0x0713868f,
+    0x071324ea, 0x0712c4b1, 0x071265fc, 0x081208e1, 0x0811ad7c, 0x081153e6,
+    0x0810fc3c, 0x0910a69d, 0x09105328, 0x09100200, 0x090fb348, 0x090f6726,
+    0x0a0f1dc0, 0x0a0ed740, 0x0a0e93cf, 0x0b0e5399, 0x0b0e16c9, 0x0b0ddd8c,
+    0x0c0da810, 0x0c0d7681, 0x0c0d490b, 0x0d0d1fd9, 0x0d0cfb13, 0x0d0cdadf,
+    0x0e0cbf5f, 0x0e0ca8b3, 0x0f0c96f5, 0x0f0c8a39, 0x0f0c828f, 0x100c8000,
+    0x100c828f, 0x110c8a39, 0x110c96f5, 0x110ca8b3, 0x120cbf5f, 0x120cdadf,
+    0x120cfb13, 0x130d1fd9, 0x130d490b, 0x140d7681, 0x140da810, 0x140ddd8c,
+    0x150e16c9, 0x150e5399, 0x150e93cf, 0x150ed740, 0x160f1dc0, 0x160f6726,
+    0x160fb348, 0x17100200, 0x17105328, 0x1710a69d, 0x1710fc3c, 0x171153e6,
+    0x1811ad7c, 0x181208e1, 0x181265fc, 0x1812c4b1, 0x181324ea, 0x1913868f,
+    0x1913e98d, 0x19144dcf, 0x1914b343, 0x191519d8, 0x1915817d, 0x1915ea24,
+    0x1a1653be, 0x1a16be3e, 0x1a172998, 0x1a1795bf, 0x1a1802ab, 0x1a18704f,
+    0x05182fd0, 0x0517c103, 0x051752e5, 0x0616e581, 0x061678e2, 0x06160d13,
+    0x0615a220, 0x06153817, 0x0614cf04, 0x061466f7, 0x06140000, 0x07139a30,
+    0x07133599, 0x0712d250, 0x07127068, 0x07120ff9, 0x0711b11a, 0x081153e6,
+    0x0810f877, 0x08109eeb, 0x08104761, 0x090ff1fa, 0x090f9ed9, 0x090f4e23,
+    0x090f0000, 0x0a0eb498, 0x0a0e6c16, 0x0a0e26a6, 0x0a0de477, 0x0b0da5b8,
+    0x0b0d6a9a, 0x0b0d334c, 0x0c0d0000, 0x0c0cd0e6, 0x0d0ca62c, 0x0d0c8000,
+    0x0d0c5e8c, 0x0e0c41f5, 0x0e0c2a60, 0x0f0c17e8, 0x0f0c0aa6, 0x0f0c02aa,
+    0x100c0000, 0x100c02aa, 0x110c0aa6, 0x110c17e8, 0x110c2a60, 0x120c41f5,
+    0x120c5e8c, 0x130c8000, 0x130ca62c, 0x130cd0e6, 0x140d0000, 0x140d334c,
+    0x140d6a9a, 0x150da5b8, 0x150de477, 0x150e26a6, 0x160e6c16, 0x160eb498,
+    0x160f0000, 0x160f4e23, 0x170f9ed9, 0x170ff1fa, 0x17104761, 0x17109eeb,
+    0x1810f877, 0x181153e6, 0x1811b11a, 0x18120ff9, 0x18127068, 0x1912d250,
+    0x19133599, 0x19139a30, 0x19140000, 0x191466f7, 0x1914cf04, 0x19153817,
+    0x1a15a220, 0x1a160d13, 0x1a1678e2, 0x1a16e581, 0x1a1752e5, 0x1a17c103,
+    0x1a182fd0, 0x0517f151, 0x0517815d, 0x0517120f, 0x0516a372, 0x05163590,
+    0x0615c874, 0x06155c2a, 0x0614f0be, 0x0614863d, 0x06141cb8, 0x0613b43d,
+    0x06134cde, 0x0712e6ac, 0x071281bb, 0x07121e20, 0x0711bbf1, 0x07115b47,
+    0x0710fc3c, 0x08109eeb, 0x08104372, 0x080fe9f1, 0x080f928a, 0x090f3d60,
+    0x090eea9b, 0x090e9a64, 0x090e4ce4, 0x0a0e0249, 0x0a0dbac2, 0x0a0d7681,
+    0x0b0d35b8, 0x0b0cf89b, 0x0b0cbf5f, 0x0c0c8a39, 0x0c0c595e, 0x0c0c2d01,
+    0x0d0c0554, 0x0d0be286, 0x0e0bc4c3, 0x0e0bac31, 0x0e0b98f0, 0x0f0b8b1c,
+    0x0f0b82c8, 0x100b8000, 0x100b82c8, 0x110b8b1c, 0x110b98f0, 0x110bac31,
+    0x120bc4c3, 0x120be286, 0x130c0554, 0x130c2d01, 0x130c595e, 0x140c8a39,
+    0x140cbf5f, 0x150cf89b, 0x150d35b8, 0x150d7681, 0x160dbac2, 0x160e0249,
+    0x160e4ce4, 0x160e9a64, 0x170eea9b, 0x170f3d60, 0x170f928a, 0x170fe9f1,
+    0x18104372, 0x18109eeb, 0x1810fc3c, 0x18115b47, 0x1811bbf1, 0x19121e20,
+    0x191281bb, 0x1912e6ac, 0x19134cde, 0x1913b43d, 0x19141cb8, 0x1a14863d,
+    0x1a14f0be, 0x1a155c2a, 0x1a15c874, 0x1a163590, 0x1a16a372, 0x1a17120f,
+    0x1a17815d, 0x1a17f151, 0x0517b4e0, 0x051743c9, 0x0516d34f, 0x0516637c,
+    0x0515f45a, 0x051585f3, 0x06151853, 0x0614ab87, 0x06143f9b, 0x0613d49e,
+    0x06136a9f, 0x061301af, 0x061299e0, 0x07123345, 0x0711cdf3, 0x07116a01,
+    0x07110786, 0x0710a69d, 0x07104761, 0x080fe9f1, 0x080f8e6d, 0x080f34f8,
+    0x080eddb7, 0x090e88d1, 0x090e3672, 0x090de6c5, 0x090d99fa, 0x0a0d5043,
+    0x0a0d09d5, 0x0a0cc6e5, 0x0b0c87ac, 0x0b0c4c62, 0x0b0c1543, 0x0c0be286,
+    0x0c0bb467, 0x0d0b8b1c, 0x0d0b66d9, 0x0e0b47d0, 0x0e0b2e2b, 0x0e0b1a10,
+    0x0f0b0b9d, 0x0f0b02e8, 0x100b0000, 0x100b02e8, 0x110b0b9d, 0x110b1a10,
+    0x120b2e2b, 0x120b47d0, 0x120b66d9, 0x130b8b1c, 0x130bb467, 0x140be286,
+    0x140c1543, 0x140c4c62, 0x150c87ac, 0x150cc6e5, 0x150d09d5, 0x160d5043,
+    0x160d99fa, 0x160de6c5, 0x170e3672, 0x170e88d1, 0x170eddb7, 0x170f34f8,
+    0x180f8e6d, 0x180fe9f1, 0x18104761, 0x1810a69d, 0x18110786, 0x19116a01,
+    0x1911cdf3, 0x19123345, 0x191299e0, 0x191301af, 0x19136a9f, 0x1a13d49e,
+    0x1a143f9b, 0x1a14ab87, 0x1a151853, 0x1a1585f3, 0x1a15f45a, 0x1a16637c,
+    0x1a16d34f, 0x1b1743c9, 0x1b17b4e0, 0x05177a8d, 0x05170858, 0x051696b6,
+    0x051625b1, 0x0515b553, 0x051545a5, 0x0514d6b3, 0x05146888, 0x0613fb33,
+    0x06138ebf, 0x0613233e, 0x0612b8be, 0x06124f51, 0x0611e70b, 0x06118000,
+    0x07111a46, 0x0710b5f5, 0x07105328, 0x070ff1fa, 0x070f928a, 0x080f34f8,
+    0x080ed968, 0x080e8000, 0x080e28e9, 0x090dd44e, 0x090d825f, 0x090d334c,
+    0x0a0ce74b, 0x0a0c9e93, 0x0a0c595e, 0x0b0c17e8, 0x0b0bda70, 0x0b0ba134,
+    0x0c0b6c75, 0x0c0b3c71, 0x0d0b1167, 0x0d0aeb90, 0x0d0acb24, 0x0e0ab054,
+    0x0e0a9b4a, 0x0f0a8c2a, 0x0f0a830c, 0x100a8000, 0x100a830c, 0x110a8c2a,
+    0x110a9b4a, 0x120ab054, 0x120acb24, 0x130aeb90, 0x130b1167, 0x130b3c71,
+    0x140b6c75, 0x140ba134, 0x150bda70, 0x150c17e8, 0x150c595e, 0x160c9e93,
+    0x160ce74b, 0x160d334c, 0x170d825f, 0x170dd44e, 0x170e28e9, 0x170e8000,
+    0x180ed968, 0x180f34f8, 0x180f928a, 0x180ff1fa, 0x18105328, 0x1910b5f5,
+    0x19111a46, 0x19118000, 0x1911e70b, 0x19124f51, 0x1a12b8be, 0x1a13233e,
+    0x1a138ebf, 0x1a13fb33, 0x1a146888, 0x1a14d6b3, 0x1a1545a5, 0x1a15b553,
+    0x1b1625b1, 0x1b1696b6, 0x1b170858, 0x1b177a8d, 0x04174268, 0x0516cf1a,
+    0x05165c56, 0x0515ea24, 0x0515788e, 0x0515079d, 0x0514975d, 0x051427d8,
+    0x0513b91c, 0x05134b35, 0x0612de33, 0x06127224, 0x0612071b, 0x06119d2a,
+    0x06113464, 0x0610cce0, 0x071066b6, 0x07100200, 0x070f9ed9, 0x070f3d60,
+    0x070eddb7, 0x080e8000, 0x080e2463, 0x080dcb0a, 0x080d7421, 0x090d1fd9,
+    0x090cce66, 0x090c8000, 0x0a0c34e1, 0x0a0bed47, 0x0a0ba973, 0x0b0b69a8,
+    0x0b0b2e2b, 0x0c0af742, 0x0c0ac534, 0x0c0a9845, 0x0d0a70b8, 0x0d0a4eca,
+    0x0e0a32b3, 0x0e0a1ca4, 0x0f0a0cc5, 0x0f0a0333, 0x100a0000, 0x100a0333,
+    0x110a0cc5, 0x110a1ca4, 0x120a32b3, 0x120a4eca, 0x130a70b8, 0x130a9845,
+    0x140ac534, 0x140af742, 0x140b2e2b, 0x150b69a8, 0x150ba973, 0x160bed47,
+    0x160c34e1, 0x160c8000, 0x170cce66, 0x170d1fd9, 0x170d7421, 0x170dcb0a,
+    0x180e2463, 0x180e8000, 0x180eddb7, 0x180f3d60, 0x190f9ed9, 0x19100200,
+    0x191066b6, 0x1910cce0, 0x19113464, 0x19119d2a, 0x1a12071b, 0x1a127224,
+    0x1a12de33, 0x1a134b35, 0x1a13b91c, 0x1a1427d8, 0x1a14975d, 0x1b15079d,
+    0x1b15788e, 0x1b15ea24, 0x1b165c56, 0x1b16cf1a, 0x1b174268, 0x04170c82,
+    0x04169821, 0x0416243f, 0x0515b0e6, 0x05153e1e, 0x0514cbf0, 0x05145a67,
+    0x0513e98d, 0x0513796e, 0x05130a18, 0x05129b98, 0x06122dfe, 0x0611c15a,
+    0x061155be, 0x0610eb3f, 0x061081f0, 0x061019eb, 0x070fb348, 0x070f4e23,
+    0x070eea9b, 0x070e88d1, 0x070e28e9, 0x080dcb0a, 0x080d6f5e, 0x080d1615,
+    0x080cbf5f, 0x090c6b74, 0x090c1a8d, 0x090bcce9, 0x0a0b82c8, 0x0a0b3c71,
+    0x0a0afa2d, 0x0b0abc47, 0x0b0a830c, 0x0c0a4eca, 0x0c0a1fcd, 0x0d09f662,
+    0x0d09d2cd, 0x0e09b54f, 0x0e099e21, 0x0f098d70, 0x0f09835e, 0x10098000,
+    0x1009835e, 0x11098d70, 0x11099e21, 0x1209b54f, 0x1209d2cd, 0x1309f662,
+    0x130a1fcd, 0x140a4eca, 0x140a830c, 0x150abc47, 0x150afa2d, 0x150b3c71,
+    0x160b82c8, 0x160bcce9, 0x160c1a8d, 0x170c6b74, 0x170cbf5f, 0x170d1615,
+    0x180d6f5e, 0x180dcb0a, 0x180e28e9, 0x180e88d1, 0x190eea9b, 0x190f4e23,
+    0x190fb348, 0x191019eb, 0x191081f0, 0x1a10eb3f, 0x1a1155be, 0x1a11c15a,
+    0x1a122dfe, 0x1a129b98, 0x1a130a18, 0x1a13796e, 0x1b13e98d, 0x1b145a67,
+    0x1b14cbf0, 0x1b153e1e, 0x1b15b0e6, 0x1b16243f, 0x1b169821, 0x1b170c82,
+    0x0416d8ea, 0x0416637c, 0x0415ee85, 0x04157a0b, 0x04150617, 0x051492b3,
+    0x05141fe7, 0x0513adbd, 0x05133c42, 0x0512cb82, 0x05125b89, 0x0511ec67,
+    0x05117e2c, 0x061110e9, 0x0610a4b0, 0x06103998, 0x060fcfb7, 0x060f6726,
+    0x060f0000, 0x070e9a64, 0x070e3672, 0x070dd44e, 0x070d7421, 0x080d1615,
+    0x080cba59, 0x080c6122, 0x080c0aa6, 0x090bb723, 0x090b66d9, 0x090b1a10,
+    0x0a0ad110, 0x0a0a8c2a, 0x0b0a4bae, 0x0b0a0ff3, 0x0c09d94f, 0x0c09a817,
+    0x0d097ca1, 0x0d09573d, 0x0e093834, 0x0e091fc8, 0x0f090e2e, 0x0f09038e,
+    0x10090000, 0x1009038e, 0x11090e2e, 0x11091fc8, 0x12093834, 0x1209573d,
+    0x13097ca1, 0x1309a817, 0x1409d94f, 0x140a0ff3, 0x150a4bae, 0x150a8c2a,
+    0x160ad110, 0x160b1a10, 0x160b66d9, 0x170bb723, 0x170c0aa6, 0x170c6122,
+    0x180cba59, 0x180d1615, 0x180d7421, 0x180dd44e, 0x190e3672, 0x190e9a64,
+    0x190f0000, 0x190f6726, 0x190fcfb7, 0x1a103998, 0x1a10a4b0, 0x1a1110e9,
+    0x1a117e2c, 0x1a11ec67, 0x1a125b89, 0x1a12cb82, 0x1b133c42, 0x1b13adbd,
+    0x1b141fe7, 0x1b1492b3, 0x1b150617, 0x1b157a0b, 0x1b15ee85, 0x1b16637c,
+    0x1b16d8ea, 0x0416a7af, 0x0416313d, 0x0415bb37, 0x041545a5, 0x0414d08d,
+    0x04145bf9, 0x0413e7f2, 0x05137480, 0x051301af, 0x05128f8b, 0x05121e20,
+    0x0511ad7c, 0x05113dae, 0x0510cec8, 0x051060db, 0x060ff3fb, 0x060f8840,
+    0x060f1dc0, 0x060eb498, 0x060e4ce4, 0x070de6c5, 0x070d825f, 0x070d1fd9,
+    0x070cbf5f, 0x080c6122, 0x080c0554, 0x080bac31, 0x090b55f6, 0x090b02e8,
+    0x090ab352, 0x0a0a6782, 0x0a0a1fcd, 0x0a09dc8e, 0x0b099e21, 0x0b0964e7,
+    0x0c093140, 0x0c09038e, 0x0d08dc2a, 0x0d08bb6d, 0x0e08a19f, 0x0f088f02,
+    0x0f0883c3, 0x10088000, 0x100883c3, 0x11088f02, 0x1208a19f, 0x1208bb6d,
+    0x1308dc2a, 0x1309038e, 0x14093140, 0x140964e7, 0x15099e21, 0x1509dc8e,
+    0x160a1fcd, 0x160a6782, 0x160ab352, 0x170b02e8, 0x170b55f6, 0x170bac31,
+    0x180c0554, 0x180c6122, 0x180cbf5f, 0x180d1fd9, 0x190d825f, 0x190de6c5,
+    0x190e4ce4, 0x190eb498, 0x1a0f1dc0, 0x1a0f8840, 0x1a0ff3fb, 0x1a1060db,
+    0x1a10cec8, 0x1a113dae, 0x1a11ad7c, 0x1b121e20, 0x1b128f8b, 0x1b1301af,
+    0x1b137480, 0x1b13e7f2, 0x1b145bf9, 0x1b14d08d, 0x1b1545a5, 0x1b15bb37,
+    0x1c16313d, 0x1c16a7af, 0x041678e2, 0x04160174, 0x04158a69, 0x041513c6,
+    0x04149d93, 0x041427d8, 0x0413b29d, 0x04133dec, 0x0412c9ce, 0x0512564e,
+    0x0511e378, 0x05117159, 0x05110000, 0x05108f7d, 0x05101fe0, 0x050fb13e,
+    0x060f43ac, 0x060ed740, 0x060e6c16, 0x060e0249, 0x060d99fa, 0x070d334c,
+    0x070cce66, 0x070c6b74, 0x070c0aa6, 0x080bac31, 0x080b504f, 0x080af742,
+    0x090aa151, 0x090a4eca, 0x090a0000, 0x0a09b54f, 0x0a096f19, 0x0b092dc5,
+    0x0b08f1bc, 0x0c08bb6d, 0x0c088b44, 0x0d0861ac, 0x0d083f08, 0x0e0823b0,
+    0x0f080ff0, 0x0f0803ff, 0x10080000, 0x100803ff, 0x11080ff0, 0x120823b0,
+    0x12083f08, 0x130861ac, 0x13088b44, 0x1408bb6d, 0x1408f1bc, 0x15092dc5,
+    0x15096f19, 0x1609b54f, 0x160a0000, 0x170a4eca, 0x170aa151, 0x170af742,
+    0x180b504f, 0x180bac31, 0x180c0aa6, 0x180c6b74, 0x190cce66, 0x190d334c,
+    0x190d99fa, 0x190e0249, 0x1a0e6c16, 0x1a0ed740, 0x1a0f43ac, 0x1a0fb13e,
+    0x1a101fe0, 0x1a108f7d, 0x1b110000, 0x1b117159, 0x1b11e378, 0x1b12564e,
+    0x1b12c9ce, 0x1b133dec, 0x1b13b29d, 0x1b1427d8, 0x1c149d93, 0x1c1513c6,
+    0x1c158a69, 0x1c160174, 0x1c1678e2, 0x03164c92, 0x0415d431, 0x04155c2a,
+    0x0414e480, 0x04146d3c, 0x0413f664, 0x04138000, 0x04130a18, 0x041294b6,
+    0x04121fe4, 0x0411abac, 0x0511381c, 0x0510c540, 0x05105328, 0x050fe1e4,
+    0x050f7186, 0x050f0222, 0x050e93cf, 0x060e26a6, 0x060dbac2, 0x060d5043,
+    0x060ce74b, 0x060c8000, 0x070c1a8d, 0x070bb723, 0x070b55f6, 0x080af742,
+    0x080a9b4a, 0x080a4257, 0x0909ecba, 0x09099acd, 0x09094cf0, 0x0a09038e,
+    0x0a08bf16, 0x0b088000, 0x0b0846c7, 0x0c0813e7, 0x0d07e7dc, 0x0d07c318,
+    0x0e07a606, 0x0e0790fe, 0x0f078443, 0x10078000, 0x10078443, 0x110790fe,
+    0x1207a606, 0x1207c318, 0x1307e7dc, 0x140813e7, 0x140846c7, 0x15088000,
+    0x1508bf16, 0x1609038e, 0x16094cf0, 0x17099acd, 0x1709ecba, 0x170a4257,
+    0x180a9b4a, 0x180af742, 0x180b55f6, 0x190bb723, 0x190c1a8d, 0x190c8000,
+    0x190ce74b, 0x190d5043, 0x1a0dbac2, 0x1a0e26a6, 0x1a0e93cf, 0x1a0f0222,
+    0x1a0f7186, 0x1b0fe1e4, 0x1b105328, 0x1b10c540, 0x1b11381c, 0x1b11abac,
+    0x1b121fe4, 0x1b1294b6, 0x1b130a18, 0x1c138000, 0x1c13f664, 0x1c146d3c,
+    0x1c14e480, 0x1c155c2a, 0x1c15d431, 0x1c164c92, 0x031622cd, 0x0315a985,
+    0x0315308b, 0x0314b7e6, 0x04143f9b, 0x0413c7b1, 0x0413502e, 0x0412d91c,
+    0x04126281, 0x0411ec67, 0x041176d9, 0x041101e2, 0x04108d8e, 0x051019eb,
+    0x050fa709, 0x050f34f8, 0x050ec3cb, 0x050e5399, 0x050de477, 0x050d7681,
+    0x060d09d5, 0x060c9e93, 0x060c34e1, 0x060bcce9, 0x070b66d9, 0x070b02e8,
+    0x070aa151, 0x080a4257, 0x0809e645, 0x08098d70, 0x09093834, 0x0908e6fa,
+    0x0a089a32, 0x0a085258, 0x0b080ff0, 0x0b07d384, 0x0c079da3, 0x0c076edb,
+    0x0d0747b5, 0x0e0728ae, 0x0e071232, 0x0f070491, 0x10070000, 0x10070491,
+    0x11071232, 0x120728ae, 0x130747b5, 0x13076edb, 0x14079da3, 0x1407d384,
+    0x15080ff0, 0x15085258, 0x16089a32, 0x1608e6fa, 0x17093834, 0x17098d70,
+    0x1809e645, 0x180a4257, 0x180aa151, 0x190b02e8, 0x190b66d9, 0x190bcce9,
+    0x190c34e1, 0x1a0c9e93, 0x1a0d09d5, 0x1a0d7681, 0x1a0de477, 0x1a0e5399,
+    0x1b0ec3cb, 0x1b0f34f8, 0x1b0fa709, 0x1b1019eb, 0x1b108d8e, 0x1b1101e2,
+    0x1b1176d9, 0x1b11ec67, 0x1c126281, 0x1c12d91c, 0x1c13502e, 0x1c13c7b1,
+    0x1c143f9b, 0x1c14b7e6, 0x1c15308b, 0x1c15a985, 0x1c1622cd, 0x0315fba2,
+    0x0315817d, 0x0315079d, 0x03148e08, 0x031414c2, 0x03139bd2, 0x0313233e,
+    0x0412ab0c, 0x04123345, 0x0411bbf1, 0x04114519, 0x0410cec8, 0x04105908,
+    0x040fe3e7, 0x040f6f73, 0x040efbbb, 0x050e88d1, 0x050e16c9, 0x050da5b8,
+    0x050d35b8, 0x050cc6e5, 0x060c595e, 0x060bed47, 0x060b82c8, 0x060b1a10,
+    0x070ab352, 0x070a4eca, 0x0709ecba, 0x08098d70, 0x08093140, 0x0808d88d,
+    0x090883c3, 0x0908335b, 0x0a07e7dc, 0x0a07a1d6, 0x0b0761e6, 0x0b0728ae,
+    0x0c06f6d5, 0x0d06ccfd, 0x0d06abbc, 0x0e069394, 0x0f0684ea, 0x10068000,
+    0x110684ea, 0x11069394, 0x1206abbc, 0x1306ccfd, 0x1306f6d5, 0x140728ae,
+    0x150761e6, 0x1507a1d6, 0x1607e7dc, 0x1608335b, 0x170883c3, 0x1708d88d,
+    0x18093140, 0x18098d70, 0x1809ecba, 0x190a4eca, 0x190ab352, 0x190b1a10,
+    0x190b82c8, 0x1a0bed47, 0x1a0c595e, 0x1a0cc6e5, 0x1a0d35b8, 0x1b0da5b8,
+    0x1b0e16c9, 0x1b0e88d1, 0x1b0efbbb, 0x1b0f6f73, 0x1b0fe3e7, 0x1b105908,
+    0x1c10cec8, 0x1c114519, 0x1c11bbf1, 0x1c123345, 0x1c12ab0c, 0x1c13233e,
+    0x1c139bd2, 0x1c1414c2, 0x1c148e08, 0x1c15079d, 0x1c15817d, 0x1c15fba2,
+    0x0315d720, 0x03155c2a, 0x0314e170, 0x031466f7, 0x0313ecc4, 0x031372db,
+    0x0312f942, 0x03128000, 0x0312071b, 0x03118e9b, 0x04111688, 0x04109eeb,
+    0x041027ce, 0x040fb13e, 0x040f3b47, 0x040ec5f6, 0x040e515d, 0x040ddd8c,
+    0x050d6a9a, 0x050cf89b, 0x050c87ac, 0x050c17e8, 0x050ba973, 0x060b3c71,
+    0x060ad110, 0x060a6782, 0x060a0000, 0x07099acd, 0x07093834, 0x0708d88d,
+    0x08087c3b, 0x080823b0, 0x0907cf6d, 0x09078000, 0x0a07360b, 0x0a06f23c,
+    0x0b06b54d, 0x0c068000, 0x0d065316, 0x0d062f46, 0x0e061530, 0x0f060553,
+    0x10060000, 0x11060553, 0x11061530, 0x12062f46, 0x13065316, 0x14068000,
+    0x1406b54d, 0x1506f23c, 0x1607360b, 0x16078000, 0x1707cf6d, 0x170823b0,
+    0x18087c3b, 0x1808d88d, 0x18093834, 0x19099acd, 0x190a0000, 0x190a6782,
+    0x1a0ad110, 0x1a0b3c71, 0x1a0ba973, 0x1a0c17e8, 0x1a0c87ac, 0x1b0cf89b,
+    0x1b0d6a9a, 0x1b0ddd8c, 0x1b0e515d, 0x1b0ec5f6, 0x1b0f3b47, 0x1c0fb13e,
+    0x1c1027ce, 0x1c109eeb, 0x1c111688, 0x1c118e9b, 0x1c12071b, 0x1c128000,
+    0x1c12f942, 0x1c1372db, 0x1c13ecc4, 0x1d1466f7, 0x1d14e170, 0x1d155c2a,
+    0x1d15d720, 0x0315b553, 0x03153999, 0x0314be12, 0x031442c4, 0x0313c7b1,
+    0x03134cde, 0x0312d250, 0x0312580c, 0x0311de19, 0x0311647d, 0x0310eb3f,
+    0x03107267, 0x040ff9ff, 0x040f8210, 0x040f0aa7, 0x040e93cf, 0x040e1d98,
+    0x040da810, 0x040d334c, 0x040cbf5f, 0x050c4c62, 0x050bda70, 0x050b69a8,
+    0x050afa2d, 0x060a8c2a, 0x060a1fcd, 0x0609b54f, 0x06094cf0, 0x0708e6fa,
+    0x070883c3, 0x070823b0, 0x0807c736, 0x08076edb, 0x09071b39, 0x0906ccfd,
+    0x0a0684ea, 0x0b0643d6, 0x0b060aa1, 0x0c05da34, 0x0d05b36d, 0x0e059715,
+    0x0f0585ce, 0x10058000, 0x110585ce, 0x12059715, 0x1205b36d, 0x1305da34,
+    0x14060aa1, 0x150643d6, 0x150684ea, 0x1606ccfd, 0x17071b39, 0x17076edb,
+    0x1807c736, 0x180823b0, 0x180883c3, 0x1908e6fa, 0x19094cf0, 0x1909b54f,
+    0x1a0a1fcd, 0x1a0a8c2a, 0x1a0afa2d, 0x1a0b69a8, 0x1b0bda70, 0x1b0c4c62,
+    0x1b0cbf5f, 0x1b0d334c, 0x1b0da810, 0x1b0e1d98, 0x1c0e93cf, 0x1c0f0aa7,
+    0x1c0f8210, 0x1c0ff9ff, 0x1c107267, 0x1c10eb3f, 0x1c11647d, 0x1c11de19,
+    0x1c12580c, 0x1d12d250, 0x1d134cde, 0x1d13c7b1, 0x1d1442c4, 0x1d14be12,
+    0x1d153999, 0x1d15b553, 0x02159648, 0x021519d8, 0x02149d93, 0x0314217e,
+    0x0313a59a, 0x031329ed, 0x0312ae7a, 0x03123345, 0x0311b855, 0x03113dae,
+    0x0310c358, 0x03104958, 0x030fcfb7, 0x030f567e, 0x030eddb7, 0x040e656c,
+    0x040dedab, 0x040d7681, 0x040d0000, 0x040c8a39, 0x040c1543, 0x040ba134,
+    0x050b2e2b, 0x050abc47, 0x050a4bae, 0x0509dc8e, 0x06096f19, 0x0609038e,
+    0x06089a32, 0x0708335b, 0x0707cf6d, 0x07076edb, 0x08071232, 0x0806ba10,
+    0x09066733, 0x0a061a70, 0x0a05d4b9, 0x0b059715, 0x0c05629a, 0x0d05385c,
+    0x0e051959, 0x0f050662, 0x10050000, 0x11050662, 0x12051959, 0x1305385c,
+    0x1405629a, 0x14059715, 0x1505d4b9, 0x16061a70, 0x17066733, 0x1706ba10,
+    0x18071232, 0x18076edb, 0x1907cf6d, 0x1908335b, 0x19089a32, 0x1a09038e,
+    0x1a096f19, 0x1a09dc8e, 0x1a0a4bae, 0x1b0abc47, 0x1b0b2e2b, 0x1b0ba134,
+    0x1b0c1543, 0x1b0c8a39, 0x1c0d0000, 0x1c0d7681, 0x1c0dedab, 0x1c0e656c,
+    0x1c0eddb7, 0x1c0f567e, 0x1c0fcfb7, 0x1c104958, 0x1c10c358, 0x1d113dae,
+    0x1d11b855, 0x1d123345, 0x1d12ae7a, 0x1d1329ed, 0x1d13a59a, 0x1d14217e,
+    0x1d149d93, 0x1d1519d8, 0x1d159648, 0x02157a0b, 0x0214fcf4, 0x02148000,
+    0x02140333, 0x0213868f, 0x02130a18, 0x02128dd1, 0x031211be, 0x031195e4,
+    0x03111a46, 0x03109eeb, 0x031023d8, 0x030fa914, 0x030f2ea6, 0x030eb498,
+    0x030e3af2, 0x030dc1bf, 0x030d490b, 0x040cd0e6, 0x040c595e, 0x040be286,
+    0x040b6c75, 0x040af742, 0x040a830c, 0x050a0ff3, 0x05099e21, 0x05092dc5,
+    0x0508bf16, 0x06085258, 0x0607e7dc, 0x06078000, 0x07071b39, 0x0706ba10,
+    0x08065d2d, 0x08060553, 0x0905b36d, 0x0a056888, 0x0b0525d7, 0x0c04eca7,
+    0x0d04be51, 0x0e049c1a, 0x0f048717, 0x10048000, 0x11048717, 0x12049c1a,
+    0x1304be51, 0x1404eca7, 0x150525d7, 0x16056888, 0x1605b36d, 0x17060553,
+    0x18065d2d, 0x1806ba10, 0x19071b39, 0x19078000, 0x1907e7dc, 0x1a085258,
+    0x1a08bf16, 0x1a092dc5, 0x1b099e21, 0x1b0a0ff3, 0x1b0a830c, 0x1b0af742,
+    0x1b0b6c75, 0x1c0be286, 0x1c0c595e, 0x1c0cd0e6, 0x1c0d490b, 0x1c0dc1bf,
+    0x1c0e3af2, 0x1c0eb498, 0x1c0f2ea6, 0x1d0fa914, 0x1d1023d8, 0x1d109eeb,
+    0x1d111a46, 0x1d1195e4, 0x1d1211be, 0x1d128dd1, 0x1d130a18, 0x1d13868f,
+    0x1d140333, 0x1d148000, 0x1d14fcf4, 0x1d157a0b, 0x021560a8, 0x0214e2f8,
+    0x02146565, 0x0213e7f2, 0x02136a9f, 0x0212ed70, 0x02127068, 0x0211f38a,
+    0x021176d9, 0x0210fa59, 0x02107e0f, 0x03100200, 0x030f8630, 0x030f0aa7,
+    0x030e8f6b, 0x030e1483, 0x030d99fa, 0x030d1fd9, 0x030ca62c, 0x030c2d01,
+    0x030bb467, 0x040b3c71, 0x040ac534, 0x040a4eca, 0x0409d94f, 0x040964e7,
+    0x0508f1bc, 0x05088000, 0x05080ff0, 0x0607a1d6, 0x0607360b, 0x0606ccfd,
+    0x07066733, 0x07060553, 0x0805a828, 0x090550a9, 0x09050000, 0x0a04b78d,
+    0x0b0478de, 0x0c0445a2, 0x0d041f84, 0x0f0407f8, 0x10040000, 0x110407f8,
+    0x12041f84, 0x130445a2, 0x140478de, 0x1504b78d, 0x16050000, 0x170550a9,
+    0x1805a828, 0x18060553, 0x19066733, 0x1906ccfd, 0x1a07360b, 0x1a07a1d6,
+    0x1a080ff0, 0x1b088000, 0x1b08f1bc, 0x1b0964e7, 0x1b09d94f, 0x1c0a4eca,
+    0x1c0ac534, 0x1c0b3c71, 0x1c0bb467, 0x1c0c2d01, 0x1c0ca62c, 0x1c0d1fd9,
+    0x1d0d99fa, 0x1d0e1483, 0x1d0e8f6b, 0x1d0f0aa7, 0x1d0f8630, 0x1d100200,
+    0x1d107e0f, 0x1d10fa59, 0x1d1176d9, 0x1d11f38a, 0x1d127068, 0x1d12ed70,
+    0x1d136a9f, 0x1d13e7f2, 0x1e146565, 0x1e14e2f8, 0x1e1560a8, 0x02154a28,
+    0x0214cbf0, 0x02144dcf, 0x0213cfc6, 0x021351d6, 0x0212d403, 0x0212564e,
+    0x0211d8b9, 0x02115b47, 0x0210ddfc, 0x021060db, 0x020fe3e7, 0x020f6726,
+    0x020eea9b, 0x020e6e4d, 0x030df242, 0x030d7681, 0x030cfb13, 0x030c8000,
+    0x030c0554, 0x030b8b1c, 0x030b1167, 0x030a9845, 0x040a1fcd, 0x0409a817,
+    0x04093140, 0x0408bb6d, 0x040846c7, 0x0507d384, 0x050761e6, 0x0506f23c,
+    0x060684ea, 0x06061a70, 0x0705b36d, 0x070550a9, 0x0804f323, 0x09049c1a,
+    0x0a044d19, 0x0b0407f8, 0x0c03ced2, 0x0d03a3db, 0x0e038919, 0x10038000,
+    0x11038919, 0x1303a3db, 0x1403ced2, 0x150407f8, 0x16044d19, 0x17049c1a,
+    0x1804f323, 0x180550a9, 0x1905b36d, 0x19061a70, 0x1a0684ea, 0x1a06f23c,
+    0x1b0761e6, 0x1b07d384, 0x1b0846c7, 0x1b08bb6d, 0x1c093140, 0x1c09a817,
+    0x1c0a1fcd, 0x1c0a9845, 0x1c0b1167, 0x1c0b8b1c, 0x1d0c0554, 0x1d0c8000,
+    0x1d0cfb13, 0x1d0d7681, 0x1d0df242, 0x1d0e6e4d, 0x1d0eea9b, 0x1d0f6726,
+    0x1d0fe3e7, 0x1d1060db, 0x1d10ddfc, 0x1d115b47, 0x1e11d8b9, 0x1e12564e,
+    0x1e12d403, 0x1e1351d6, 0x1e13cfc6, 0x1e144dcf, 0x1e14cbf0, 0x1e154a28,
+    0x01153695, 0x0114b7e6, 0x01143948, 0x0213babb, 0x02133c42, 0x0212bdde,
+    0x02123f90, 0x0211c15a, 0x0211433f, 0x0210c540, 0x02104761, 0x020fc9a4,
+    0x020f4c0c, 0x020ece9e, 0x020e515d, 0x020dd44e, 0x020d5777, 0x020cdadf,
+    0x020c5e8c, 0x030be286, 0x030b66d9, 0x030aeb90, 0x030a70b8, 0x0309f662,
+    0x03097ca1, 0x0309038e, 0x04088b44, 0x040813e7, 0x04079da3, 0x040728ae,
+    0x0506b54d, 0x050643d6, 0x0505d4b9, 0x06056888, 0x06050000, 0x07049c1a,
+    0x08043e1e, 0x0903e7b6, 0x0a039b05, 0x0b035aa6, 0x0d03298b, 0x0e030a98,
+    0x10030000, 0x11030a98, 0x1303298b, 0x14035aa6, 0x16039b05, 0x1703e7b6,
+    0x18043e1e, 0x18049c1a, 0x19050000, 0x1a056888, 0x1a05d4b9, 0x1a0643d6,
+    0x1b06b54d, 0x1b0728ae, 0x1b079da3, 0x1c0813e7, 0x1c088b44, 0x1c09038e,
+    0x1c097ca1, 0x1c09f662, 0x1d0a70b8, 0x1d0aeb90, 0x1d0b66d9, 0x1d0be286,
+    0x1d0c5e8c, 0x1d0cdadf, 0x1d0d5777, 0x1d0dd44e, 0x1d0e515d, 0x1d0ece9e,
+    0x1e0f4c0c, 0x1e0fc9a4, 0x1e104761, 0x1e10c540, 0x1e11433f, 0x1e11c15a,
+    0x1e123f90, 0x1e12bdde, 0x1e133c42, 0x1e13babb, 0x1e143948, 0x1e14b7e6,
+    0x1e153695, 0x011525f6, 0x0114a6e1, 0x011427d8, 0x0113a8dc, 0x011329ed,
+    0x0112ab0c, 0x01122c3b, 0x0111ad7c, 0x01112ecf, 0x0210b036, 0x021031b3,
+    0x020fb348, 0x020f34f8, 0x020eb6c5, 0x020e38b2, 0x020dbac2, 0x020d3cfb,
+    0x020cbf5f, 0x020c41f5, 0x020bc4c3, 0x020b47d0, 0x020acb24, 0x020a4eca,
+    0x0309d2cd, 0x0309573d, 0x0308dc2a, 0x030861ac, 0x0307e7dc, 0x03076edb,
+    0x0406f6d5, 0x04068000, 0x04060aa1, 0x05059715, 0x050525d7, 0x0604b78d,
+    0x06044d19, 0x0703e7b6, 0x08038919, 0x0903339a, 0x0a02ea5d, 0x0c02b14d,
+    0x0e028cad, 0x10028000, 0x12028cad, 0x1402b14d, 0x1502ea5d, 0x1703339a,
+    0x18038919, 0x1903e7b6, 0x19044d19, 0x1a04b78d, 0x1a0525d7, 0x1b059715,
+    0x1b060aa1, 0x1c068000, 0x1c06f6d5, 0x1c076edb, 0x1c07e7dc, 0x1c0861ac,
+    0x1d08dc2a, 0x1d09573d, 0x1d09d2cd, 0x1d0a4eca, 0x1d0acb24, 0x1d0b47d0,
+    0x1d0bc4c3, 0x1d0c41f5, 0x1e0cbf5f, 0x1e0d3cfb, 0x1e0dbac2, 0x1e0e38b2,
+    0x1e0eb6c5, 0x1e0f34f8, 0x1e0fb348, 0x1e1031b3, 0x1e10b036, 0x1e112ecf,
+    0x1e11ad7c, 0x1e122c3b, 0x1e12ab0c, 0x1e1329ed, 0x1e13a8dc, 0x1e1427d8,
+    0x1e14a6e1, 0x1e1525f6, 0x01151853, 0x011498eb, 0x01141989, 0x01139a30,
+    0x01131ae0, 0x01129b98, 0x01121c5b, 0x01119d2a, 0x01111e04, 0x01109eeb,
+    0x01101fe0, 0x010fa0e5, 0x010f21fc, 0x010ea325, 0x010e2463, 0x010da5b8,
+    0x020d2727, 0x020ca8b3, 0x020c2a60, 0x020bac31, 0x020b2e2b, 0x020ab054,
+    0x020a32b3, 0x0209b54f, 0x02093834, 0x0208bb6d, 0x02083f08, 0x0307c318,
+    0x030747b5, 0x0306ccfd, 0x03065316, 0x0305da34, 0x0405629a, 0x0404eca7,
+    0x050478de, 0x050407f8, 0x06039b05, 0x0703339a, 0x0802d414, 0x09028000,
+    0x0b023c6f, 0x0d020fc2, 0x10020000, 0x12020fc2, 0x14023c6f, 0x16028000,
+    0x1802d414, 0x1903339a, 0x1a039b05, 0x1a0407f8, 0x1b0478de, 0x1b04eca7,
+    0x1c05629a, 0x1c05da34, 0x1c065316, 0x1d06ccfd, 0x1d0747b5, 0x1d07c318,
+    0x1d083f08, 0x1d08bb6d, 0x1d093834, 0x1d09b54f, 0x1e0a32b3, 0x1e0ab054,
+    0x1e0b2e2b, 0x1e0bac31, 0x1e0c2a60, 0x1e0ca8b3, 0x1e0d2727, 0x1e0da5b8,
+    0x1e0e2463, 0x1e0ea325, 0x1e0f21fc, 0x1e0fa0e5, 0x1e101fe0, 0x1e109eeb,
+    0x1e111e04, 0x1e119d2a, 0x1e121c5b, 0x1e129b98, 0x1e131ae0, 0x1e139a30,
+    0x1f141989, 0x1f1498eb, 0x1f151853, 0x01150db2, 0x01148e08, 0x01140e61,
+    0x01138ebf, 0x01130f22, 0x01128f8b, 0x01120ff9, 0x0111906d, 0x011110e9,
+    0x0110916b, 0x011011f6, 0x010f928a, 0x010f1327, 0x010e93cf, 0x010e1483,
+    0x010d9545, 0x010d1615, 0x010c96f5, 0x010c17e8, 0x010b98f0, 0x010b1a10,
+    0x010a9b4a, 0x010a1ca4, 0x02099e21, 0x02091fc8, 0x0208a19f, 0x020823b0,
+    0x0207a606, 0x020728ae, 0x0206abbc, 0x02062f46, 0x0305b36d, 0x0305385c,
+    0x0304be51, 0x040445a2, 0x0403ced2, 0x05035aa6, 0x0502ea5d, 0x06028000,
+    0x08021f0f, 0x0a01cd83, 0x0d0194c6, 0x10018000, 0x130194c6, 0x1601cd83,
+    0x18021f0f, 0x19028000, 0x1a02ea5d, 0x1b035aa6, 0x1b03ced2, 0x1c0445a2,
+    0x1c04be51, 0x1d05385c, 0x1d05b36d, 0x1d062f46, 0x1d06abbc, 0x1d0728ae,
+    0x1e07a606, 0x1e0823b0, 0x1e08a19f, 0x1e091fc8, 0x1e099e21, 0x1e0a1ca4,
+    0x1e0a9b4a, 0x1e0b1a10, 0x1e0b98f0, 0x1e0c17e8, 0x1e0c96f5, 0x1e0d1615,
+    0x1e0d9545, 0x1e0e1483, 0x1e0e93cf, 0x1f0f1327, 0x1f0f928a, 0x1f1011f6,
+    0x1f10916b, 0x1f1110e9, 0x1f11906d, 0x1f120ff9, 0x1f128f8b, 0x1f130f22,
+    0x1f138ebf, 0x1f140e61, 0x1f148e08, 0x1f150db2, 0x00150617, 0x0014863d,
+    0x01140665, 0x0113868f, 0x011306bb, 0x011286ea, 0x0112071b, 0x0111874f,
+    0x01110786, 0x011087c0, 0x011007fe, 0x010f8840, 0x010f0886, 0x010e88d1,
+    0x010e0922, 0x010d8978, 0x010d09d5, 0x010c8a39, 0x010c0aa6, 0x010b8b1c,
+    0x010b0b9d, 0x010a8c2a, 0x010a0cc5, 0x01098d70, 0x01090e2e, 0x01088f02,
+    0x01080ff0, 0x010790fe, 0x01071232, 0x02069394, 0x02061530, 0x02059715,
+    0x02051959, 0x02049c1a, 0x02041f84, 0x0303a3db, 0x0303298b, 0x0402b14d,
+    0x05023c6f, 0x0601cd83, 0x08016a0a, 0x0b011e37, 0x10010000, 0x14011e37,
+    0x18016a0a, 0x1a01cd83, 0x1b023c6f, 0x1c02b14d, 0x1c03298b, 0x1d03a3db,
+    0x1d041f84, 0x1d049c1a, 0x1e051959, 0x1e059715, 0x1e061530, 0x1e069394,
+    0x1e071232, 0x1e0790fe, 0x1e080ff0, 0x1e088f02, 0x1e090e2e, 0x1e098d70,
+    0x1f0a0cc5, 0x1f0a8c2a, 0x1f0b0b9d, 0x1f0b8b1c, 0x1f0c0aa6, 0x1f0c8a39,
+    0x1f0d09d5, 0x1f0d8978, 0x1f0e0922, 0x1f0e88d1, 0x1f0f0886, 0x1f0f8840,
+    0x1f1007fe, 0x1f1087c0, 0x1f110786, 0x1f11874f, 0x1f12071b, 0x1f1286ea,
+    0x1f1306bb, 0x1f13868f, 0x1f140665, 0x1f14863d, 0x1f150617, 0x00150186,
+    0x00148190, 0x0014019a, 0x001381a4, 0x001301af, 0x001281bb, 0x001201c7,
+    0x001181d4, 0x001101e2, 0x001081f0, 0x00100200, 0x000f8210, 0x000f0222,
+    0x000e8235, 0x000e0249, 0x000d825f, 0x000d0276, 0x000c828f, 0x000c02aa,
+    0x000b82c8, 0x000b02e8, 0x000a830c, 0x010a0333, 0x0109835e, 0x0109038e,
+    0x010883c3, 0x010803ff, 0x01078443, 0x01070491, 0x010684ea, 0x01060553,
+    0x010585ce, 0x01050662, 0x01048717, 0x010407f8, 0x01038919, 0x02030a98,
+    0x02028cad, 0x02020fc2, 0x030194c6, 0x05011e37, 0x0800b505, 0x10008000,
+    0x1800b505, 0x1b011e37, 0x1c0194c6, 0x1d020fc2, 0x1e028cad, 0x1e030a98,
+    0x1e038919, 0x1e0407f8, 0x1e048717, 0x1f050662, 0x1f0585ce, 0x1f060553,
+    0x1f0684ea, 0x1f070491, 0x1f078443, 0x1f0803ff, 0x1f0883c3, 0x1f09038e,
+    0x1f09835e, 0x1f0a0333, 0x1f0a830c, 0x1f0b02e8, 0x1f0b82c8, 0x1f0c02aa,
+    0x1f0c828f, 0x1f0d0276, 0x1f0d825f, 0x1f0e0249, 0x1f0e8235, 0x1f0f0222,
+    0x1f0f8210, 0x1f100200, 0x1f1081f0, 0x1f1101e2, 0x1f1181d4, 0x1f1201c7,
+    0x1f1281bb, 0x1f1301af, 0x1f1381a4, 0x1f14019a, 0x1f148190, 0x1f150186,
+    0x3f150000, 0x3f148000, 0x3f140000, 0x3f138000, 0x3f130000, 0x3f128000,
+    0x3f120000, 0x3f118000, 0x3f110000, 0x3f108000, 0x3f100000, 0x3f0f8000,
+    0x3f0f0000, 0x3f0e8000, 0x3f0e0000, 0x3f0d8000, 0x3f0d0000, 0x3f0c8000,
+    0x3f0c0000, 0x3f0b8000, 0x3f0b0000, 0x3f0a8000, 0x3f0a0000, 0x3f098000,
+    0x3f090000, 0x3f088000, 0x3f080000, 0x3f078000, 0x3f070000, 0x3f068000,
+    0x3f060000, 0x3f058000, 0x3f050000, 0x3f048000, 0x3f040000, 0x3f038000,
+    0x3f030000, 0x3f028000, 0x3f020000, 0x3f018000, 0x3f010000, 0x3f008000,
+    0x20000000, 0x20008000, 0x20010000, 0x20018000, 0x20020000, 0x20028000,
+    0x20030000, 0x20038000, 0x20040000, 0x20048000, 0x20050000, 0x20058000,
+    0x20060000, 0x20068000, 0x20070000, 0x20078000, 0x20080000, 0x20088000,
+    0x20090000, 0x20098000, 0x200a0000, 0x200a8000, 0x200b0000, 0x200b8000,
+    0x200c0000, 0x200c8000, 0x200d0000, 0x200d8000, 0x200e0000, 0x200e8000,
+    0x200f0000, 0x200f8000, 0x20100000, 0x20108000, 0x20110000, 0x20118000,
+    0x20120000, 0x20128000, 0x20130000, 0x20138000, 0x20140000, 0x20148000,
+    0x20150000, 0x3f150186, 0x3f148190, 0x3f14019a, 0x3f1381a4, 0x3f1301af,
+    0x3f1281bb, 0x3f1201c7, 0x3f1181d4, 0x3f1101e2, 0x3f1081f0, 0x3f100200,
+    0x3f0f8210, 0x3f0f0222, 0x3f0e8235, 0x3f0e0249, 0x3f0d825f, 0x3f0d0276,
+    0x3f0c828f, 0x3f0c02aa, 0x3f0b82c8, 0x3f0b02e8, 0x3f0a830c, 0x3e0a0333,
+    0x3e09835e, 0x3e09038e, 0x3e0883c3, 0x3e0803ff, 0x3e078443, 0x3e070491,
+    0x3e0684ea, 0x3e060553, 0x3e0585ce, 0x3e050662, 0x3e048717, 0x3e0407f8,
+    0x3e038919, 0x3d030a98, 0x3d028cad, 0x3d020fc2, 0x3c0194c6, 0x3a011e37,
+    0x3700b505, 0x2f008000, 0x2700b505, 0x24011e37, 0x230194c6, 0x22020fc2,
+    0x21028cad, 0x21030a98, 0x21038919, 0x210407f8, 0x21048717, 0x20050662,
+    0x200585ce, 0x20060553, 0x200684ea, 0x20070491, 0x20078443, 0x200803ff,
+    0x200883c3, 0x2009038e, 0x2009835e, 0x200a0333, 0x200a830c, 0x200b02e8,
+    0x200b82c8, 0x200c02aa, 0x200c828f, 0x200d0276, 0x200d825f, 0x200e0249,
+    0x200e8235, 0x200f0222, 0x200f8210, 0x20100200, 0x201081f0, 0x201101e2,
+    0x201181d4, 0x201201c7, 0x201281bb, 0x201301af, 0x201381a4, 0x2014019a,
+    0x20148190, 0x20150186, 0x3f150617, 0x3f14863d, 0x3e140665, 0x3e13868f,
+    0x3e1306bb, 0x3e1286ea, 0x3e12071b, 0x3e11874f, 0x3e110786, 0x3e1087c0,
+    0x3e1007fe, 0x3e0f8840, 0x3e0f0886, 0x3e0e88d1, 0x3e0e0922, 0x3e0d8978,
+    0x3e0d09d5, 0x3e0c8a39, 0x3e0c0aa6, 0x3e0b8b1c, 0x3e0b0b9d, 0x3e0a8c2a,
+    0x3e0a0cc5, 0x3e098d70, 0x3e090e2e, 0x3e088f02, 0x3e080ff0, 0x3e0790fe,
+    0x3e071232, 0x3d069394, 0x3d061530, 0x3d059715, 0x3d051959, 0x3d049c1a,
+    0x3d041f84, 0x3c03a3db, 0x3c03298b, 0x3b02b14d, 0x3a023c6f, 0x3901cd83,
+    0x37016a0a, 0x34011e37, 0x2f010000, 0x2b011e37, 0x27016a0a, 0x2501cd83,
+    0x24023c6f, 0x2302b14d, 0x2303298b, 0x2203a3db, 0x22041f84, 0x22049c1a,
+    0x21051959, 0x21059715, 0x21061530, 0x21069394, 0x21071232, 0x210790fe,
+    0x21080ff0, 0x21088f02, 0x21090e2e, 0x21098d70, 0x200a0cc5, 0x200a8c2a,
+    0x200b0b9d, 0x200b8b1c, 0x200c0aa6, 0x200c8a39, 0x200d09d5, 0x200d8978,
+    0x200e0922, 0x200e88d1, 0x200f0886, 0x200f8840, 0x201007fe, 0x201087c0,
+    0x20110786, 0x2011874f, 0x2012071b, 0x201286ea, 0x201306bb, 0x2013868f,
+    0x20140665, 0x2014863d, 0x20150617, 0x3e150db2, 0x3e148e08, 0x3e140e61,
+    0x3e138ebf, 0x3e130f22, 0x3e128f8b, 0x3e120ff9, 0x3e11906d, 0x3e1110e9,
+    0x3e10916b, 0x3e1011f6, 0x3e0f928a, 0x3e0f1327, 0x3e0e93cf, 0x3e0e1483,
+    0x3e0d9545, 0x3e0d1615, 0x3e0c96f5, 0x3e0c17e8, 0x3e0b98f0, 0x3e0b1a10,
+    0x3e0a9b4a, 0x3e0a1ca4, 0x3d099e21, 0x3d091fc8, 0x3d08a19f, 0x3d0823b0,
+    0x3d07a606, 0x3d0728ae, 0x3d06abbc, 0x3d062f46, 0x3c05b36d, 0x3c05385c,
+    0x3c04be51, 0x3b0445a2, 0x3b03ced2, 0x3a035aa6, 0x3a02ea5d, 0x39028000,
+    0x37021f0f, 0x3501cd83, 0x320194c6, 0x2f018000, 0x2c0194c6, 0x2901cd83,
+    0x27021f0f, 0x26028000, 0x2502ea5d, 0x24035aa6, 0x2403ced2, 0x230445a2,
+    0x2304be51, 0x2205385c, 0x2205b36d, 0x22062f46, 0x2206abbc, 0x220728ae,
+    0x2107a606, 0x210823b0, 0x2108a19f, 0x21091fc8, 0x21099e21, 0x210a1ca4,
+    0x210a9b4a, 0x210b1a10, 0x210b98f0, 0x210c17e8, 0x210c96f5, 0x210d1615,
+    0x210d9545, 0x210e1483, 0x210e93cf, 0x200f1327, 0x200f928a, 0x201011f6,
+    0x2010916b, 0x201110e9, 0x2011906d, 0x20120ff9, 0x20128f8b, 0x20130f22,
+    0x20138ebf, 0x20140e61, 0x20148e08, 0x20150db2, 0x3e151853, 0x3e1498eb,
+    0x3e141989, 0x3e139a30, 0x3e131ae0, 0x3e129b98, 0x3e121c5b, 0x3e119d2a,
+    0x3e111e04, 0x3e109eeb, 0x3e101fe0, 0x3e0fa0e5, 0x3e0f21fc, 0x3e0ea325,
+    0x3e0e2463, 0x3e0da5b8, 0x3d0d2727, 0x3d0ca8b3, 0x3d0c2a60, 0x3d0bac31,
+    0x3d0b2e2b, 0x3d0ab054, 0x3d0a32b3, 0x3d09b54f, 0x3d093834, 0x3d08bb6d,
+    0x3d083f08, 0x3c07c318, 0x3c0747b5, 0x3c06ccfd, 0x3c065316, 0x3c05da34,
+    0x3b05629a, 0x3b04eca7, 0x3a0478de, 0x3a0407f8, 0x39039b05, 0x3803339a,
+    0x3702d414, 0x36028000, 0x34023c6f, 0x32020fc2, 0x2f020000, 0x2d020fc2,
+    0x2b023c6f, 0x29028000, 0x2702d414, 0x2603339a, 0x25039b05, 0x250407f8,
+    0x240478de, 0x2404eca7, 0x2305629a, 0x2305da34, 0x23065316, 0x2206ccfd,
+    0x220747b5, 0x2207c318, 0x22083f08, 0x2208bb6d, 0x22093834, 0x2209b54f,
+    0x210a32b3, 0x210ab054, 0x210b2e2b, 0x210bac31, 0x210c2a60, 0x210ca8b3,
+    0x210d2727, 0x210da5b8, 0x210e2463, 0x210ea325, 0x210f21fc, 0x210fa0e5,
+    0x21101fe0, 0x21109eeb, 0x21111e04, 0x21119d2a, 0x21121c5b, 0x21129b98,
+    0x21131ae0, 0x21139a30, 0x20141989, 0x201498eb, 0x20151853, 0x3e1525f6,
+    0x3e14a6e1, 0x3e1427d8, 0x3e13a8dc, 0x3e1329ed, 0x3e12ab0c, 0x3e122c3b,
+    0x3e11ad7c, 0x3e112ecf, 0x3d10b036, 0x3d1031b3, 0x3d0fb348, 0x3d0f34f8,
+    0x3d0eb6c5, 0x3d0e38b2, 0x3d0dbac2, 0x3d0d3cfb, 0x3d0cbf5f, 0x3d0c41f5,
+    0x3d0bc4c3, 0x3d0b47d0, 0x3d0acb24, 0x3d0a4eca, 0x3c09d2cd, 0x3c09573d,
+    0x3c08dc2a, 0x3c0861ac, 0x3c07e7dc, 0x3c076edb, 0x3b06f6d5, 0x3b068000,
+    0x3b060aa1, 0x3a059715, 0x3a0525d7, 0x3904b78d, 0x39044d19, 0x3803e7b6,
+    0x37038919, 0x3603339a, 0x3502ea5d, 0x3302b14d, 0x31028cad, 0x2f028000,
+    0x2d028cad, 0x2b02b14d, 0x2a02ea5d, 0x2803339a, 0x27038919, 0x2603e7b6,
+    0x26044d19, 0x2504b78d, 0x250525d7, 0x24059715, 0x24060aa1, 0x23068000,
+    0x2306f6d5, 0x23076edb, 0x2307e7dc, 0x230861ac, 0x2208dc2a, 0x2209573d,
+    0x2209d2cd, 0x220a4eca, 0x220acb24, 0x220b47d0, 0x220bc4c3, 0x220c41f5,
+    0x210cbf5f, 0x210d3cfb, 0x210dbac2, 0x210e38b2, 0x210eb6c5, 0x210f34f8,
+    0x210fb348, 0x211031b3, 0x2110b036, 0x21112ecf, 0x2111ad7c, 0x21122c3b,
+    0x2112ab0c, 0x211329ed, 0x2113a8dc, 0x211427d8, 0x2114a6e1, 0x211525f6,
+    0x3e153695, 0x3e14b7e6, 0x3e143948, 0x3d13babb, 0x3d133c42, 0x3d12bdde,
+    0x3d123f90, 0x3d11c15a, 0x3d11433f, 0x3d10c540, 0x3d104761, 0x3d0fc9a4,
+    0x3d0f4c0c, 0x3d0ece9e, 0x3d0e515d, 0x3d0dd44e, 0x3d0d5777, 0x3d0cdadf,
+    0x3d0c5e8c, 0x3c0be286, 0x3c0b66d9, 0x3c0aeb90, 0x3c0a70b8, 0x3c09f662,
+    0x3c097ca1, 0x3c09038e, 0x3b088b44, 0x3b0813e7, 0x3b079da3, 0x3b0728ae,
+    0x3a06b54d, 0x3a0643d6, 0x3a05d4b9, 0x39056888, 0x39050000, 0x38049c1a,
+    0x37043e1e, 0x3603e7b6, 0x35039b05, 0x34035aa6, 0x3203298b, 0x31030a98,
+    0x2f030000, 0x2e030a98, 0x2c03298b, 0x2b035aa6, 0x29039b05, 0x2803e7b6,
+    0x27043e1e, 0x27049c1a, 0x26050000, 0x25056888, 0x2505d4b9, 0x250643d6,
+    0x2406b54d, 0x240728ae, 0x24079da3, 0x230813e7, 0x23088b44, 0x2309038e,
+    0x23097ca1, 0x2309f662, 0x220a70b8, 0x220aeb90, 0x220b66d9, 0x220be286,
+    0x220c5e8c, 0x220cdadf, 0x220d5777, 0x220dd44e, 0x220e515d, 0x220ece9e,
+    0x210f4c0c, 0x210fc9a4, 0x21104761, 0x2110c540, 0x2111433f, 0x2111c15a,
+    0x21123f90, 0x2112bdde, 0x21133c42, 0x2113babb, 0x21143948, 0x2114b7e6,
+    0x21153695, 0x3d154a28, 0x3d14cbf0, 0x3d144dcf, 0x3d13cfc6, 0x3d1351d6,
+    0x3d12d403, 0x3d12564e, 0x3d11d8b9, 0x3d115b47, 0x3d10ddfc, 0x3d1060db,
+    0x3d0fe3e7, 0x3d0f6726, 0x3d0eea9b, 0x3d0e6e4d, 0x3c0df242, 0x3c0d7681,
+    0x3c0cfb13, 0x3c0c8000, 0x3c0c0554, 0x3c0b8b1c, 0x3c0b1167, 0x3c0a9845,
+    0x3b0a1fcd, 0x3b09a817, 0x3b093140, 0x3b08bb6d, 0x3b0846c7, 0x3a07d384,
+    0x3a0761e6, 0x3a06f23c, 0x390684ea, 0x39061a70, 0x3805b36d, 0x380550a9,
+    0x3704f323, 0x36049c1a, 0x35044d19, 0x340407f8, 0x3303ced2, 0x3203a3db,
+    0x31038919, 0x2f038000, 0x2e038919, 0x2c03a3db, 0x2b03ced2, 0x2a0407f8,
+    0x29044d19, 0x28049c1a, 0x2704f323, 0x270550a9, 0x2605b36d, 0x26061a70,
+    0x250684ea, 0x2506f23c, 0x240761e6, 0x2407d384, 0x240846c7, 0x2408bb6d,
+    0x23093140, 0x2309a817, 0x230a1fcd, 0x230a9845, 0x230b1167, 0x230b8b1c,
+    0x220c0554, 0x220c8000, 0x220cfb13, 0x220d7681, 0x220df242, 0x220e6e4d,
+    0x220eea9b, 0x220f6726, 0x220fe3e7, 0x221060db, 0x2210ddfc, 0x22115b47,
+    0x2111d8b9, 0x2112564e, 0x2112d403, 0x211351d6, 0x2113cfc6, 0x21144dcf,
+    0x2114cbf0, 0x21154a28, 0x3d1560a8, 0x3d14e2f8, 0x3d146565, 0x3d13e7f2,
+    0x3d136a9f, 0x3d12ed70, 0x3d127068, 0x3d11f38a, 0x3d1176d9, 0x3d10fa59,
+    0x3d107e0f, 0x3c100200, 0x3c0f8630, 0x3c0f0aa7, 0x3c0e8f6b, 0x3c0e1483,
+    0x3c0d99fa, 0x3c0d1fd9, 0x3c0ca62c, 0x3c0c2d01, 0x3c0bb467, 0x3b0b3c71,
+    0x3b0ac534, 0x3b0a4eca, 0x3b09d94f, 0x3b0964e7, 0x3a08f1bc, 0x3a088000,
+    0x3a080ff0, 0x3907a1d6, 0x3907360b, 0x3906ccfd, 0x38066733, 0x38060553,
+    0x3705a828, 0x360550a9, 0x36050000, 0x3504b78d, 0x340478de, 0x330445a2,
+    0x32041f84, 0x300407f8, 0x2f040000, 0x2e0407f8, 0x2d041f84, 0x2c0445a2,
+    0x2b0478de, 0x2a04b78d, 0x29050000, 0x280550a9, 0x2705a828, 0x27060553,
+    0x26066733, 0x2606ccfd, 0x2507360b, 0x2507a1d6, 0x25080ff0, 0x24088000,
+    0x2408f1bc, 0x240964e7, 0x2409d94f, 0x230a4eca, 0x230ac534, 0x230b3c71,
+    0x230bb467, 0x230c2d01, 0x230ca62c, 0x230d1fd9, 0x220d99fa, 0x220e1483,
+    0x220e8f6b, 0x220f0aa7, 0x220f8630, 0x22100200, 0x22107e0f, 0x2210fa59,
+    0x221176d9, 0x2211f38a, 0x22127068, 0x2212ed70, 0x22136a9f, 0x2213e7f2,
+    0x21146565, 0x2114e2f8, 0x211560a8, 0x3d157a0b, 0x3d14fcf4, 0x3d148000,
+    0x3d140333, 0x3d13868f, 0x3d130a18, 0x3d128dd1, 0x3c1211be, 0x3c1195e4,
+    0x3c111a46, 0x3c109eeb, 0x3c1023d8, 0x3c0fa914, 0x3c0f2ea6, 0x3c0eb498,
+    0x3c0e3af2, 0x3c0dc1bf, 0x3c0d490b, 0x3b0cd0e6, 0x3b0c595e, 0x3b0be286,
+    0x3b0b6c75, 0x3b0af742, 0x3b0a830c, 0x3a0a0ff3, 0x3a099e21, 0x3a092dc5,
+    0x3a08bf16, 0x39085258, 0x3907e7dc, 0x39078000, 0x38071b39, 0x3806ba10,
+    0x37065d2d, 0x37060553, 0x3605b36d, 0x35056888, 0x340525d7, 0x3304eca7,
+    0x3204be51, 0x31049c1a, 0x30048717, 0x2f048000, 0x2e048717, 0x2d049c1a,
+    0x2c04be51, 0x2b04eca7, 0x2a0525d7, 0x29056888, 0x2905b36d, 0x28060553,
+    0x27065d2d, 0x2706ba10, 0x26071b39, 0x26078000, 0x2607e7dc, 0x25085258,
+    0x2508bf16, 0x25092dc5, 0x24099e21, 0x240a0ff3, 0x240a830c, 0x240af742,
+    0x240b6c75, 0x230be286, 0x230c595e, 0x230cd0e6, 0x230d490b, 0x230dc1bf,
+    0x230e3af2, 0x230eb498, 0x230f2ea6, 0x220fa914, 0x221023d8, 0x22109eeb,
+    0x22111a46, 0x221195e4, 0x221211be, 0x22128dd1, 0x22130a18, 0x2213868f,
+    0x22140333, 0x22148000, 0x2214fcf4, 0x22157a0b, 0x3d159648, 0x3d1519d8,
+    0x3d149d93, 0x3c14217e, 0x3c13a59a, 0x3c1329ed, 0x3c12ae7a, 0x3c123345,
+    0x3c11b855, 0x3c113dae, 0x3c10c358, 0x3c104958, 0x3c0fcfb7, 0x3c0f567e,
+    0x3c0eddb7, 0x3b0e656c, 0x3b0dedab, 0x3b0d7681, 0x3b0d0000, 0x3b0c8a39,
+    0x3b0c1543, 0x3b0ba134, 0x3a0b2e2b, 0x3a0abc47, 0x3a0a4bae, 0x3a09dc8e,
+    0x39096f19, 0x3909038e, 0x39089a32, 0x3808335b, 0x3807cf6d, 0x38076edb,
+    0x37071232, 0x3706ba10, 0x36066733, 0x35061a70, 0x3505d4b9, 0x34059715,
+    0x3305629a, 0x3205385c, 0x31051959, 0x30050662, 0x2f050000, 0x2e050662,
+    0x2d051959, 0x2c05385c, 0x2b05629a, 0x2b059715, 0x2a05d4b9, 0x29061a70,
+    0x28066733, 0x2806ba10, 0x27071232, 0x27076edb, 0x2607cf6d, 0x2608335b,
+    0x26089a32, 0x2509038e, 0x25096f19, 0x2509dc8e, 0x250a4bae, 0x240abc47,
+    0x240b2e2b, 0x240ba134, 0x240c1543, 0x240c8a39, 0x230d0000, 0x230d7681,
+    0x230dedab, 0x230e656c, 0x230eddb7, 0x230f567e, 0x230fcfb7, 0x23104958,
+    0x2310c358, 0x22113dae, 0x2211b855, 0x22123345, 0x2212ae7a, 0x221329ed,
+    0x2213a59a, 0x2214217e, 0x22149d93, 0x221519d8, 0x22159648, 0x3c15b553,
+    0x3c153999, 0x3c14be12, 0x3c1442c4, 0x3c13c7b1, 0x3c134cde, 0x3c12d250,
+    0x3c12580c, 0x3c11de19, 0x3c11647d, 0x3c10eb3f, 0x3c107267, 0x3b0ff9ff,
+    0x3b0f8210, 0x3b0f0aa7, 0x3b0e93cf, 0x3b0e1d98, 0x3b0da810, 0x3b0d334c,
+    0x3b0cbf5f, 0x3a0c4c62, 0x3a0bda70, 0x3a0b69a8, 0x3a0afa2d, 0x390a8c2a,
+    0x390a1fcd, 0x3909b54f, 0x39094cf0, 0x3808e6fa, 0x380883c3, 0x380823b0,
+    0x3707c736, 0x37076edb, 0x36071b39, 0x3606ccfd, 0x350684ea, 0x340643d6,
+    0x34060aa1, 0x3305da34, 0x3205b36d, 0x31059715, 0x300585ce, 0x2f058000,
+    0x2e0585ce, 0x2d059715, 0x2d05b36d, 0x2c05da34, 0x2b060aa1, 0x2a0643d6,
+    0x2a0684ea, 0x2906ccfd, 0x28071b39, 0x28076edb, 0x2707c736, 0x270823b0,
+    0x270883c3, 0x2608e6fa, 0x26094cf0, 0x2609b54f, 0x250a1fcd, 0x250a8c2a,
+    0x250afa2d, 0x250b69a8, 0x240bda70, 0x240c4c62, 0x240cbf5f, 0x240d334c,
+    0x240da810, 0x240e1d98, 0x230e93cf, 0x230f0aa7, 0x230f8210, 0x230ff9ff,
+    0x23107267, 0x2310eb3f, 0x2311647d, 0x2311de19, 0x2312580c, 0x2212d250,
+    0x22134cde, 0x2213c7b1, 0x221442c4, 0x2214be12, 0x22153999, 0x2215b553,
+    0x3c15d720, 0x3c155c2a, 0x3c14e170, 0x3c1466f7, 0x3c13ecc4, 0x3c1372db,
+    0x3c12f942, 0x3c128000, 0x3c12071b, 0x3c118e9b, 0x3b111688, 0x3b109eeb,
+    0x3b1027ce, 0x3b0fb13e, 0x3b0f3b47, 0x3b0ec5f6, 0x3b0e515d, 0x3b0ddd8c,
+    0x3a0d6a9a, 0x3a0cf89b, 0x3a0c87ac, 0x3a0c17e8, 0x3a0ba973, 0x390b3c71,
+    0x390ad110, 0x390a6782, 0x390a0000, 0x38099acd, 0x38093834, 0x3808d88d,
+    0x37087c3b, 0x370823b0, 0x3607cf6d, 0x36078000, 0x3507360b, 0x3506f23c,
+    0x3406b54d, 0x33068000, 0x32065316, 0x32062f46, 0x31061530, 0x30060553,
+    0x2f060000, 0x2e060553, 0x2e061530, 0x2d062f46, 0x2c065316, 0x2b068000,
+    0x2b06b54d, 0x2a06f23c, 0x2907360b, 0x29078000, 0x2807cf6d, 0x280823b0,
+    0x27087c3b, 0x2708d88d, 0x27093834, 0x26099acd, 0x260a0000, 0x260a6782,
+    0x250ad110, 0x250b3c71, 0x250ba973, 0x250c17e8, 0x250c87ac, 0x240cf89b,
+    0x240d6a9a, 0x240ddd8c, 0x240e515d, 0x240ec5f6, 0x240f3b47, 0x230fb13e,
+    0x231027ce, 0x23109eeb, 0x23111688, 0x23118e9b, 0x2312071b, 0x23128000,
+    0x2312f942, 0x231372db, 0x2313ecc4, 0x221466f7, 0x2214e170, 0x22155c2a,
+    0x2215d720, 0x3c15fba2, 0x3c15817d, 0x3c15079d, 0x3c148e08, 0x3c1414c2,
+    0x3c139bd2, 0x3c13233e, 0x3b12ab0c, 0x3b123345, 0x3b11bbf1, 0x3b114519,
+    0x3b10cec8, 0x3b105908, 0x3b0fe3e7, 0x3b0f6f73, 0x3b0efbbb, 0x3a0e88d1,
+    0x3a0e16c9, 0x3a0da5b8, 0x3a0d35b8, 0x3a0cc6e5, 0x390c595e, 0x390bed47,
+    0x390b82c8, 0x390b1a10, 0x380ab352, 0x380a4eca, 0x3809ecba, 0x37098d70,
+    0x37093140, 0x3708d88d, 0x360883c3, 0x3608335b, 0x3507e7dc, 0x3507a1d6,
+    0x340761e6, 0x340728ae, 0x3306f6d5, 0x3206ccfd, 0x3206abbc, 0x31069394,
+    0x300684ea, 0x2f068000, 0x2e0684ea, 0x2e069394, 0x2d06abbc, 0x2c06ccfd,
+    0x2c06f6d5, 0x2b0728ae, 0x2a0761e6, 0x2a07a1d6, 0x2907e7dc, 0x2908335b,
+    0x280883c3, 0x2808d88d, 0x27093140, 0x27098d70, 0x2709ecba, 0x260a4eca,
+    0x260ab352, 0x260b1a10, 0x260b82c8, 0x250bed47, 0x250c595e, 0x250cc6e5,
+    0x250d35b8, 0x240da5b8, 0x240e16c9, 0x240e88d1, 0x240efbbb, 0x240f6f73,
+    0x240fe3e7, 0x24105908, 0x2310cec8, 0x23114519, 0x2311bbf1, 0x23123345,
+    0x2312ab0c, 0x2313233e, 0x23139bd2, 0x231414c2, 0x23148e08, 0x2315079d,
+    0x2315817d, 0x2315fba2, 0x3c1622cd, 0x3c15a985, 0x3c15308b, 0x3c14b7e6,
+    0x3b143f9b, 0x3b13c7b1, 0x3b13502e, 0x3b12d91c, 0x3b126281, 0x3b11ec67,
+    0x3b1176d9, 0x3b1101e2, 0x3b108d8e, 0x3a1019eb, 0x3a0fa709, 0x3a0f34f8,
+    0x3a0ec3cb, 0x3a0e5399, 0x3a0de477, 0x3a0d7681, 0x390d09d5, 0x390c9e93,
+    0x390c34e1, 0x390bcce9, 0x380b66d9, 0x380b02e8, 0x380aa151, 0x370a4257,
+    0x3709e645, 0x37098d70, 0x36093834, 0x3608e6fa, 0x35089a32, 0x35085258,
+    0x34080ff0, 0x3407d384, 0x33079da3, 0x33076edb, 0x320747b5, 0x310728ae,
+    0x31071232, 0x30070491, 0x2f070000, 0x2f070491, 0x2e071232, 0x2d0728ae,
+    0x2c0747b5, 0x2c076edb, 0x2b079da3, 0x2b07d384, 0x2a080ff0, 0x2a085258,
+    0x29089a32, 0x2908e6fa, 0x28093834, 0x28098d70, 0x2709e645, 0x270a4257,
+    0x270aa151, 0x260b02e8, 0x260b66d9, 0x260bcce9, 0x260c34e1, 0x250c9e93,
+    0x250d09d5, 0x250d7681, 0x250de477, 0x250e5399, 0x240ec3cb, 0x240f34f8,
+    0x240fa709, 0x241019eb, 0x24108d8e, 0x241101e2, 0x241176d9, 0x2411ec67,
+    0x23126281, 0x2312d91c, 0x2313502e, 0x2313c7b1, 0x23143f9b, 0x2314b7e6,
+    0x2315308b, 0x2315a985, 0x231622cd, 0x3c164c92, 0x3b15d431, 0x3b155c2a,
+    0x3b14e480, 0x3b146d3c, 0x3b13f664, 0x3b138000, 0x3b130a18, 0x3b1294b6,
+    0x3b121fe4, 0x3b11abac, 0x3a11381c, 0x3a10c540, 0x3a105328, 0x3a0fe1e4,
+    0x3a0f7186, 0x3a0f0222, 0x3a0e93cf, 0x390e26a6, 0x390dbac2, 0x390d5043,
+    0x390ce74b, 0x390c8000, 0x380c1a8d, 0x380bb723, 0x380b55f6, 0x370af742,
+    0x370a9b4a, 0x370a4257, 0x3609ecba, 0x36099acd, 0x36094cf0, 0x3509038e,
+    0x3508bf16, 0x34088000, 0x340846c7, 0x330813e7, 0x3207e7dc, 0x3207c318,
+    0x3107a606, 0x310790fe, 0x30078443, 0x2f078000, 0x2f078443, 0x2e0790fe,
+    0x2d07a606, 0x2d07c318, 0x2c07e7dc, 0x2b0813e7, 0x2b0846c7, 0x2a088000,
+    0x2a08bf16, 0x2909038e, 0x29094cf0, 0x28099acd, 0x2809ecba, 0x280a4257,
+    0x270a9b4a, 0x270af742, 0x270b55f6, 0x260bb723, 0x260c1a8d, 0x260c8000,
+    0x260ce74b, 0x260d5043, 0x250dbac2, 0x250e26a6, 0x250e93cf, 0x250f0222,
+    0x250f7186, 0x240fe1e4, 0x24105328, 0x2410c540, 0x2411381c, 0x2411abac,
+    0x24121fe4, 0x241294b6, 0x24130a18, 0x23138000, 0x2313f664, 0x23146d3c,
+    0x2314e480, 0x23155c2a, 0x2315d431, 0x23164c92, 0x3b1678e2, 0x3b160174,
+    0x3b158a69, 0x3b1513c6, 0x3b149d93, 0x3b1427d8, 0x3b13b29d, 0x3b133dec,
+    0x3b12c9ce, 0x3a12564e, 0x3a11e378, 0x3a117159, 0x3a110000, 0x3a108f7d,
+    0x3a101fe0, 0x3a0fb13e, 0x390f43ac, 0x390ed740, 0x390e6c16, 0x390e0249,
+    0x390d99fa, 0x380d334c, 0x380cce66, 0x380c6b74, 0x380c0aa6, 0x370bac31,
+    0x370b504f, 0x370af742, 0x360aa151, 0x360a4eca, 0x360a0000, 0x3509b54f,
+    0x35096f19, 0x34092dc5, 0x3408f1bc, 0x3308bb6d, 0x33088b44, 0x320861ac,
+    0x32083f08, 0x310823b0, 0x30080ff0, 0x300803ff, 0x2f080000, 0x2f0803ff,
+    0x2e080ff0, 0x2d0823b0, 0x2d083f08, 0x2c0861ac, 0x2c088b44, 0x2b08bb6d,
+    0x2b08f1bc, 0x2a092dc5, 0x2a096f19, 0x2909b54f, 0x290a0000, 0x280a4eca,
+    0x280aa151, 0x280af742, 0x270b504f, 0x270bac31, 0x270c0aa6, 0x270c6b74,
+    0x260cce66, 0x260d334c, 0x260d99fa, 0x260e0249, 0x250e6c16, 0x250ed740,
+    0x250f43ac, 0x250fb13e, 0x25101fe0, 0x25108f7d, 0x24110000, 0x24117159,
+    0x2411e378, 0x2412564e, 0x2412c9ce, 0x24133dec, 0x2413b29d, 0x241427d8,
+    0x23149d93, 0x231513c6, 0x23158a69, 0x23160174, 0x231678e2, 0x3b16a7af,
+    0x3b16313d, 0x3b15bb37, 0x3b1545a5, 0x3b14d08d, 0x3b145bf9, 0x3b13e7f2,
+    0x3a137480, 0x3a1301af, 0x3a128f8b, 0x3a121e20, 0x3a11ad7c, 0x3a113dae,
+    0x3a10cec8, 0x3a1060db, 0x390ff3fb, 0x390f8840, 0x390f1dc0, 0x390eb498,
+    0x390e4ce4, 0x380de6c5, 0x380d825f, 0x380d1fd9, 0x380cbf5f, 0x370c6122,
+    0x370c0554, 0x370bac31, 0x360b55f6, 0x360b02e8, 0x360ab352, 0x350a6782,
+    0x350a1fcd, 0x3509dc8e, 0x34099e21, 0x340964e7, 0x33093140, 0x3309038e,
+    0x3208dc2a, 0x3208bb6d, 0x3108a19f, 0x30088f02, 0x300883c3, 0x2f088000,
+    0x2f0883c3, 0x2e088f02, 0x2d08a19f, 0x2d08bb6d, 0x2c08dc2a, 0x2c09038e,
+    0x2b093140, 0x2b0964e7, 0x2a099e21, 0x2a09dc8e, 0x290a1fcd, 0x290a6782,
+    0x290ab352, 0x280b02e8, 0x280b55f6, 0x280bac31, 0x270c0554, 0x270c6122,
+    0x270cbf5f, 0x270d1fd9, 0x260d825f, 0x260de6c5, 0x260e4ce4, 0x260eb498,
+    0x250f1dc0, 0x250f8840, 0x250ff3fb, 0x251060db, 0x2510cec8, 0x25113dae,
+    0x2511ad7c, 0x24121e20, 0x24128f8b, 0x241301af, 0x24137480, 0x2413e7f2,
+    0x24145bf9, 0x2414d08d, 0x241545a5, 0x2415bb37, 0x2316313d, 0x2316a7af,
+    0x3b16d8ea, 0x3b16637c, 0x3b15ee85, 0x3b157a0b, 0x3b150617, 0x3a1492b3,
+    0x3a141fe7, 0x3a13adbd, 0x3a133c42, 0x3a12cb82, 0x3a125b89, 0x3a11ec67,
+    0x3a117e2c, 0x391110e9, 0x3910a4b0, 0x39103998, 0x390fcfb7, 0x390f6726,
+    0x390f0000, 0x380e9a64, 0x380e3672, 0x380dd44e, 0x380d7421, 0x370d1615,
+    0x370cba59, 0x370c6122, 0x370c0aa6, 0x360bb723, 0x360b66d9, 0x360b1a10,
+    0x350ad110, 0x350a8c2a, 0x340a4bae, 0x340a0ff3, 0x3309d94f, 0x3309a817,
+    0x32097ca1, 0x3209573d, 0x31093834, 0x31091fc8, 0x30090e2e, 0x3009038e,
+    0x2f090000, 0x2f09038e, 0x2e090e2e, 0x2e091fc8, 0x2d093834, 0x2d09573d,
+    0x2c097ca1, 0x2c09a817, 0x2b09d94f, 0x2b0a0ff3, 0x2a0a4bae, 0x2a0a8c2a,
+    0x290ad110, 0x290b1a10, 0x290b66d9, 0x280bb723, 0x280c0aa6, 0x280c6122,
+    0x270cba59, 0x270d1615, 0x270d7421, 0x270dd44e, 0x260e3672, 0x260e9a64,
+    0x260f0000, 0x260f6726, 0x260fcfb7, 0x25103998, 0x2510a4b0, 0x251110e9,
+    0x25117e2c, 0x2511ec67, 0x25125b89, 0x2512cb82, 0x24133c42, 0x2413adbd,
+    0x24141fe7, 0x241492b3, 0x24150617, 0x24157a0b, 0x2415ee85, 0x2416637c,
+    0x2416d8ea, 0x3b170c82, 0x3b169821, 0x3b16243f, 0x3a15b0e6, 0x3a153e1e,
+    0x3a14cbf0, 0x3a145a67, 0x3a13e98d, 0x3a13796e, 0x3a130a18, 0x3a129b98,
+    0x39122dfe, 0x3911c15a, 0x391155be, 0x3910eb3f, 0x391081f0, 0x391019eb,
+    0x380fb348, 0x380f4e23, 0x380eea9b, 0x380e88d1, 0x380e28e9, 0x370dcb0a,
+    0x370d6f5e, 0x370d1615, 0x370cbf5f, 0x360c6b74, 0x360c1a8d, 0x360bcce9,
+    0x350b82c8, 0x350b3c71, 0x350afa2d, 0x340abc47, 0x340a830c, 0x330a4eca,
+    0x330a1fcd, 0x3209f662, 0x3209d2cd, 0x3109b54f, 0x31099e21, 0x30098d70,
+    0x3009835e, 0x2f098000, 0x2f09835e, 0x2e098d70, 0x2e099e21, 0x2d09b54f,
+    0x2d09d2cd, 0x2c09f662, 0x2c0a1fcd, 0x2b0a4eca, 0x2b0a830c, 0x2a0abc47,
+    0x2a0afa2d, 0x2a0b3c71, 0x290b82c8, 0x290bcce9, 0x290c1a8d, 0x280c6b74,
+    0x280cbf5f, 0x280d1615, 0x270d6f5e, 0x270dcb0a, 0x270e28e9, 0x270e88d1,
+    0x260eea9b, 0x260f4e23, 0x260fb348, 0x261019eb, 0x261081f0, 0x2510eb3f,
+    0x251155be, 0x2511c15a, 0x25122dfe, 0x25129b98, 0x25130a18, 0x2513796e,
+    0x2413e98d, 0x24145a67, 0x2414cbf0, 0x24153e1e, 0x2415b0e6, 0x2416243f,
+    0x24169821, 0x24170c82, 0x3b174268, 0x3a16cf1a, 0x3a165c56, 0x3a15ea24,
+    0x3a15788e, 0x3a15079d, 0x3a14975d, 0x3a1427d8, 0x3a13b91c, 0x3a134b35,
+    0x3912de33, 0x39127224, 0x3912071b, 0x39119d2a, 0x39113464, 0x3910cce0,
+    0x381066b6, 0x38100200, 0x380f9ed9, 0x380f3d60, 0x380eddb7, 0x370e8000,
+    0x370e2463, 0x370dcb0a, 0x370d7421, 0x360d1fd9, 0x360cce66, 0x360c8000,
+    0x350c34e1, 0x350bed47, 0x350ba973, 0x340b69a8, 0x340b2e2b, 0x330af742,
+    0x330ac534, 0x330a9845, 0x320a70b8, 0x320a4eca, 0x310a32b3, 0x310a1ca4,
+    0x300a0cc5, 0x300a0333, 0x2f0a0000, 0x2f0a0333, 0x2e0a0cc5, 0x2e0a1ca4,
+    0x2d0a32b3, 0x2d0a4eca, 0x2c0a70b8, 0x2c0a9845, 0x2b0ac534, 0x2b0af742,
+    0x2b0b2e2b, 0x2a0b69a8, 0x2a0ba973, 0x290bed47, 0x290c34e1, 0x290c8000,
+    0x280cce66, 0x280d1fd9, 0x280d7421, 0x280dcb0a, 0x270e2463, 0x270e8000,
+    0x270eddb7, 0x270f3d60, 0x260f9ed9, 0x26100200, 0x261066b6, 0x2610cce0,
+    0x26113464, 0x26119d2a, 0x2512071b, 0x25127224, 0x2512de33, 0x25134b35,
+    0x2513b91c, 0x251427d8, 0x2514975d, 0x2415079d, 0x2415788e, 0x2415ea24,
+    0x24165c56, 0x2416cf1a, 0x24174268, 0x3a177a8d, 0x3a170858, 0x3a1696b6,
+    0x3a1625b1, 0x3a15b553, 0x3a1545a5, 0x3a14d6b3, 0x3a146888, 0x3913fb33,
+    0x39138ebf, 0x3913233e, 0x3912b8be, 0x39124f51, 0x3911e70b, 0x39118000,
+    0x38111a46, 0x3810b5f5, 0x38105328, 0x380ff1fa, 0x380f928a, 0x370f34f8,
+    0x370ed968, 0x370e8000, 0x370e28e9, 0x360dd44e, 0x360d825f, 0x360d334c,
+    0x350ce74b, 0x350c9e93, 0x350c595e, 0x340c17e8, 0x340bda70, 0x340ba134,
+    0x330b6c75, 0x330b3c71, 0x320b1167, 0x320aeb90, 0x320acb24, 0x310ab054,
+    0x310a9b4a, 0x300a8c2a, 0x300a830c, 0x2f0a8000, 0x2f0a830c, 0x2e0a8c2a,
+    0x2e0a9b4a, 0x2d0ab054, 0x2d0acb24, 0x2c0aeb90, 0x2c0b1167, 0x2c0b3c71,
+    0x2b0b6c75, 0x2b0ba134, 0x2a0bda70, 0x2a0c17e8, 0x2a0c595e, 0x290c9e93,
+    0x290ce74b, 0x290d334c, 0x280d825f, 0x280dd44e, 0x280e28e9, 0x280e8000,
+    0x270ed968, 0x270f34f8, 0x270f928a, 0x270ff1fa, 0x27105328, 0x2610b5f5,
+    0x26111a46, 0x26118000, 0x2611e70b, 0x26124f51, 0x2512b8be, 0x2513233e,
+    0x25138ebf, 0x2513fb33, 0x25146888, 0x2514d6b3, 0x251545a5, 0x2515b553,
+    0x241625b1, 0x241696b6, 0x24170858, 0x24177a8d, 0x3a17b4e0, 0x3a1743c9,
+    0x3a16d34f, 0x3a16637c, 0x3a15f45a, 0x3a1585f3, 0x39151853, 0x3914ab87,
+    0x39143f9b, 0x3913d49e, 0x39136a9f, 0x391301af, 0x391299e0, 0x38123345,
+    0x3811cdf3, 0x38116a01, 0x38110786, 0x3810a69d, 0x38104761, 0x370fe9f1,
+    0x370f8e6d, 0x370f34f8, 0x370eddb7, 0x360e88d1, 0x360e3672, 0x360de6c5,
+    0x360d99fa, 0x350d5043, 0x350d09d5, 0x350cc6e5, 0x340c87ac, 0x340c4c62,
+    0x340c1543, 0x330be286, 0x330bb467, 0x320b8b1c, 0x320b66d9, 0x310b47d0,
+    0x310b2e2b, 0x310b1a10, 0x300b0b9d, 0x300b02e8, 0x2f0b0000, 0x2f0b02e8,
+    0x2e0b0b9d, 0x2e0b1a10, 0x2d0b2e2b, 0x2d0b47d0, 0x2d0b66d9, 0x2c0b8b1c,
+    0x2c0bb467, 0x2b0be286, 0x2b0c1543, 0x2b0c4c62, 0x2a0c87ac, 0x2a0cc6e5,
+    0x2a0d09d5, 0x290d5043, 0x290d99fa, 0x290de6c5, 0x280e3672, 0x280e88d1,
+    0x280eddb7, 0x280f34f8, 0x270f8e6d, 0x270fe9f1, 0x27104761, 0x2710a69d,
+    0x27110786, 0x26116a01, 0x2611cdf3, 0x26123345, 0x261299e0, 0x261301af,
+    0x26136a9f, 0x2513d49e, 0x25143f9b, 0x2514ab87, 0x25151853, 0x251585f3,
+    0x2515f45a, 0x2516637c, 0x2516d34f, 0x241743c9, 0x2417b4e0, 0x3a17f151,
+    0x3a17815d, 0x3a17120f, 0x3a16a372, 0x3a163590, 0x3915c874, 0x39155c2a,
+    0x3914f0be, 0x3914863d, 0x39141cb8, 0x3913b43d, 0x39134cde, 0x3812e6ac,
+    0x381281bb, 0x38121e20, 0x3811bbf1, 0x38115b47, 0x3810fc3c, 0x37109eeb,
+    0x37104372, 0x370fe9f1, 0x370f928a, 0x360f3d60, 0x360eea9b, 0x360e9a64,
+    0x360e4ce4, 0x350e0249, 0x350dbac2, 0x350d7681, 0x340d35b8, 0x340cf89b,
+    0x340cbf5f, 0x330c8a39, 0x330c595e, 0x330c2d01, 0x320c0554, 0x320be286,
+    0x310bc4c3, 0x310bac31, 0x310b98f0, 0x300b8b1c, 0x300b82c8, 0x2f0b8000,
+    0x2f0b82c8, 0x2e0b8b1c, 0x2e0b98f0, 0x2e0bac31, 0x2d0bc4c3, 0x2d0be286,
+    0x2c0c0554, 0x2c0c2d01, 0x2c0c595e, 0x2b0c8a39, 0x2b0cbf5f, 0x2a0cf89b,
+    0x2a0d35b8, 0x2a0d7681, 0x290dbac2, 0x290e0249, 0x290e4ce4, 0x290e9a64,
+    0x280eea9b, 0x280f3d60, 0x280f928a, 0x280fe9f1, 0x27104372, 0x27109eeb,
+    0x2710fc3c, 0x27115b47, 0x2711bbf1, 0x26121e20, 0x261281bb, 0x2612e6ac,
+    0x26134cde, 0x2613b43d, 0x26141cb8, 0x2514863d, 0x2514f0be, 0x25155c2a,
+    0x2515c874, 0x25163590, 0x2516a372, 0x2517120f, 0x2517815d, 0x2517f151,
+    0x3a182fd0, 0x3a17c103, 0x3a1752e5, 0x3916e581, 0x391678e2, 0x39160d13,
+    0x3915a220, 0x39153817, 0x3914cf04, 0x391466f7, 0x39140000, 0x38139a30,
+    0x38133599, 0x3812d250, 0x38127068, 0x38120ff9, 0x3811b11a, 0x371153e6,
+    0x3710f877, 0x37109eeb, 0x37104761, 0x360ff1fa, 0x360f9ed9, 0x360f4e23,
+    0x360f0000, 0x350eb498, 0x350e6c16, 0x350e26a6, 0x350de477, 0x340da5b8,
+    0x340d6a9a, 0x340d334c, 0x330d0000, 0x330cd0e6, 0x320ca62c, 0x320c8000,
+    0x320c5e8c, 0x310c41f5, 0x310c2a60, 0x300c17e8, 0x300c0aa6, 0x300c02aa,
+    0x2f0c0000, 0x2f0c02aa, 0x2e0c0aa6, 0x2e0c17e8, 0x2e0c2a60, 0x2d0c41f5,
+    0x2d0c5e8c, 0x2c0c8000, 0x2c0ca62c, 0x2c0cd0e6, 0x2b0d0000, 0x2b0d334c,
+    0x2b0d6a9a, 0x2a0da5b8, 0x2a0de477, 0x2a0e26a6, 0x290e6c16, 0x290eb498,
+    0x290f0000, 0x290f4e23, 0x280f9ed9, 0x280ff1fa, 0x28104761, 0x28109eeb,
+    0x2710f877, 0x271153e6, 0x2711b11a, 0x27120ff9, 0x27127068, 0x2612d250,
+    0x26133599, 0x26139a30, 0x26140000, 0x261466f7, 0x2614cf04, 0x26153817,
+    0x2515a220, 0x25160d13, 0x251678e2, 0x2516e581, 0x251752e5, 0x2517c103,
+    0x25182fd0, 0x3a18704f, 0x3a1802ab, 0x391795bf, 0x39172998, 0x3916be3e,
+    0x391653be, 0x3915ea24, 0x3915817d, 0x391519d8, 0x3814b343, 0x38144dcf,
+    0x3813e98d, 0x3813868f, 0x381324ea, 0x3812c4b1, 0x381265fc, 0x371208e1,
+    0x3711ad7c, 0x371153e6, 0x3710fc3c, 0x3610a69d, 0x36105328, 0x36100200,
+    0x360fb348, 0x360f6726, 0x350f1dc0, 0x350ed740, 0x350e93cf, 0x340e5399,
+    0x340e16c9, 0x340ddd8c, 0x330da810, 0x330d7681, 0x330d490b, 0x320d1fd9,
+    0x320cfb13, 0x320cdadf, 0x310cbf5f, 0x310ca8b3, 0x300c96f5, 0x300c8a39,
+    0x300c828f, 0x2f0c8000, 0x2f0c828f, 0x2e0c8a39, 0x2e0c96f5, 0x2e0ca8b3,
+    0x2d0cbf5f, 0x2d0cdadf, 0x2d0cfb13, 0x2c0d1fd9, 0x2c0d490b, 0x2b0d7681,
+    0x2b0da810, 0x2b0ddd8c, 0x2a0e16c9, 0x2a0e5399, 0x2a0e93cf, 0x2a0ed740,
+    0x290f1dc0, 0x290f6726, 0x290fb348, 0x28100200, 0x28105328, 0x2810a69d,
+    0x2810fc3c, 0x281153e6, 0x2711ad7c, 0x271208e1, 0x271265fc, 0x2712c4b1,
+    0x271324ea, 0x2613868f, 0x2613e98d, 0x26144dcf, 0x2614b343, 0x261519d8,
+    0x2615817d, 0x2615ea24, 0x251653be, 0x2516be3e, 0x25172998, 0x251795bf,
+    0x251802ab, 0x2518704f, 0x3918b2bc, 0x39184644, 0x3917da8d, 0x39176fa3,
+    0x39170590, 0x39169c60, 0x3916341f, 0x3915ccdc, 0x381566a4, 0x38150186,
+    0x38149d93, 0x38143add, 0x3813d974, 0x3813796e, 0x37131ae0, 0x3712bdde,
+    0x37126281, 0x371208e1, 0x3711b11a, 0x37115b47, 0x36110786, 0x3610b5f5,
+    0x361066b6, 0x361019eb, 0x350fcfb7, 0x350f8840, 0x350f43ac, 0x340f0222,
+    0x340ec3cb, 0x340e88d1, 0x340e515d, 0x330e1d98, 0x330dedab, 0x330dc1bf,
+    0x320d99fa, 0x320d7681, 0x320d5777, 0x310d3cfb, 0x310d2727, 0x300d1615,
+    0x300d09d5, 0x300d0276, 0x2f0d0000, 0x2f0d0276, 0x2e0d09d5, 0x2e0d1615,
+    0x2e0d2727, 0x2d0d3cfb, 0x2d0d5777, 0x2d0d7681, 0x2c0d99fa, 0x2c0dc1bf,
+    0x2c0dedab, 0x2b0e1d98, 0x2b0e515d, 0x2b0e88d1, 0x2a0ec3cb, 0x2a0f0222,
+    0x2a0f43ac, 0x290f8840, 0x290fcfb7, 0x291019eb, 0x291066b6, 0x2810b5f5,
+    0x28110786, 0x28115b47, 0x2811b11a, 0x281208e1, 0x27126281, 0x2712bdde,
+    0x27131ae0, 0x2713796e, 0x2713d974, 0x26143add, 0x26149d93, 0x26150186,
+    0x261566a4, 0x2615ccdc, 0x2616341f, 0x26169c60, 0x26170590, 0x25176fa3,
+    0x2517da8d, 0x25184644, 0x2518b2bc, 0x3918f709, 0x39188bbe, 0x3918213e,
+    0x3917b793, 0x39174ec7, 0x3916e6e7, 0x39168000, 0x38161a1f, 0x3815b553,
+    0x381551aa, 0x3814ef36, 0x38148e08, 0x38142e31, 0x3713cfc6, 0x371372db,
+    0x37131786, 0x3712bdde, 0x371265fc, 0x37120ff9, 0x3611bbf1, 0x36116a01,
+    0x36111a46, 0x3610cce0, 0x351081f0, 0x35103998, 0x350ff3fb, 0x350fb13e,
+    0x340f7186, 0x340f34f8, 0x340efbbb, 0x330ec5f6, 0x330e93cf, 0x330e656c,
+    0x320e3af2, 0x320e1483, 0x320df242, 0x310dd44e, 0x310dbac2, 0x310da5b8,
+    0x300d9545, 0x300d8978, 0x300d825f, 0x2f0d8000, 0x2f0d825f, 0x2f0d8978,
+    0x2e0d9545, 0x2e0da5b8, 0x2d0dbac2, 0x2d0dd44e, 0x2d0df242, 0x2c0e1483,
+    0x2c0e3af2, 0x2c0e656c, 0x2b0e93cf, 0x2b0ec5f6, 0x2b0efbbb, 0x2a0f34f8,
+    0x2a0f7186, 0x2a0fb13e, 0x2a0ff3fb, 0x29103998, 0x291081f0, 0x2910cce0,
+    0x29111a46, 0x28116a01, 0x2811bbf1, 0x28120ff9, 0x281265fc, 0x2812bdde,
+    0x27131786, 0x271372db, 0x2713cfc6, 0x27142e31, 0x27148e08, 0x2714ef36,
+    0x261551aa, 0x2615b553, 0x26161a1f, 0x26168000, 0x2616e6e7, 0x26174ec7,
+    0x2617b793, 0x2518213e, 0x25188bbe, 0x2518f709, 0x39193d26, 0x3918d30b,
+    0x391869c2, 0x39180155, 0x391799d1, 0x39173341, 0x3816cdb3, 0x38166933,
+    0x381605d1, 0x3815a39b, 0x381542a2, 0x3814e2f8, 0x371484ae, 0x371427d8,
+    0x3713cc8b, 0x371372db, 0x37131ae0, 0x3712c4b1, 0x36127068, 0x36121e20,
+    0x3611cdf3, 0x36118000, 0x35113464, 0x3510eb3f, 0x3510a4b0, 0x351060db,
+    0x34101fe0, 0x340fe1e4, 0x340fa709, 0x340f6f73, 0x330f3b47, 0x330f0aa7,
+    0x330eddb7, 0x320eb498, 0x320e8f6b, 0x320e6e4d, 0x310e515d, 0x310e38b2,
+    0x310e2463, 0x300e1483, 0x300e0922, 0x300e0249, 0x2f0e0000, 0x2f0e0249,
+    0x2f0e0922, 0x2e0e1483, 0x2e0e2463, 0x2d0e38b2, 0x2d0e515d, 0x2d0e6e4d,
+    0x2c0e8f6b, 0x2c0eb498, 0x2c0eddb7, 0x2b0f0aa7, 0x2b0f3b47, 0x2b0f6f73,
+    0x2b0fa709, 0x2a0fe1e4, 0x2a101fe0, 0x2a1060db, 0x2a10a4b0, 0x2910eb3f,
+    0x29113464, 0x29118000, 0x2911cdf3, 0x28121e20, 0x28127068, 0x2812c4b1,
+    0x28131ae0, 0x281372db, 0x2713cc8b, 0x271427d8, 0x271484ae, 0x2714e2f8,
+    0x271542a2, 0x2715a39b, 0x261605d1, 0x26166933, 0x2616cdb3, 0x26173341,
+    0x261799d1, 0x26180155, 0x261869c2, 0x2618d30b, 0x25193d26, 0x39198505,
+    0x39191c19, 0x3918b407, 0x39184cda, 0x3817e69d, 0x3817815d, 0x38171d25,
+    0x3816ba05, 0x3816580a, 0x3815f744, 0x381597c3, 0x37153999, 0x3714dcd6,
+    0x37148190, 0x371427d8, 0x3713cfc6, 0x3713796e, 0x361324ea, 0x3612d250,
+    0x361281bb, 0x36123345, 0x3611e70b, 0x35119d2a, 0x351155be, 0x351110e9,
+    0x3510cec8, 0x34108f7d, 0x34105328, 0x341019eb, 0x330fe3e7, 0x330fb13e,
+    0x330f8210, 0x330f567e, 0x320f2ea6, 0x320f0aa7, 0x320eea9b, 0x310ece9e,
+    0x310eb6c5, 0x310ea325, 0x300e93cf, 0x300e88d1, 0x300e8235, 0x2f0e8000,
+    0x2f0e8235, 0x2f0e88d1, 0x2e0e93cf, 0x2e0ea325, 0x2e0eb6c5, 0x2d0ece9e,
+    0x2d0eea9b, 0x2d0f0aa7, 0x2c0f2ea6, 0x2c0f567e, 0x2c0f8210, 0x2b0fb13e,
+    0x2b0fe3e7, 0x2b1019eb, 0x2a105328, 0x2a108f7d, 0x2a10cec8, 0x2a1110e9,
+    0x291155be, 0x29119d2a, 0x2911e70b, 0x29123345, 0x291281bb, 0x2812d250,
+    0x281324ea, 0x2813796e, 0x2813cfc6, 0x281427d8, 0x27148190, 0x2714dcd6,
+    0x27153999, 0x271597c3, 0x2715f744, 0x2716580a, 0x2616ba05, 0x26171d25,
+    0x2617815d, 0x2617e69d, 0x26184cda, 0x2618b407, 0x26191c19, 0x26198505,
+    0x3919ce96, 0x391966db, 0x39190000, 0x38189a11, 0x3818351b, 0x3817d128,
+    0x38176e46, 0x38170c82, 0x3816abec, 0x38164c92, 0x3715ee85, 0x371591d5,
+    0x37153695, 0x3714dcd6, 0x371484ae, 0x37142e31, 0x3613d974, 0x3613868f,
+    0x36133599, 0x3612e6ac, 0x361299e0, 0x35124f51, 0x3512071b, 0x3511c15a,
+    0x35117e2c, 0x34113dae, 0x34110000, 0x3410c540, 0x34108d8e, 0x33105908,
+    0x331027ce, 0x330ff9ff, 0x320fcfb7, 0x320fa914, 0x320f8630, 0x320f6726,
+    0x310f4c0c, 0x310f34f8, 0x310f21fc, 0x300f1327, 0x300f0886, 0x300f0222,
+    0x2f0f0000, 0x2f0f0222, 0x2f0f0886, 0x2e0f1327, 0x2e0f21fc, 0x2e0f34f8,
+    0x2d0f4c0c, 0x2d0f6726, 0x2d0f8630, 0x2c0fa914, 0x2c0fcfb7, 0x2c0ff9ff,
+    0x2b1027ce, 0x2b105908, 0x2b108d8e, 0x2b10c540, 0x2a110000, 0x2a113dae,
+    0x2a117e2c, 0x2a11c15a, 0x2912071b, 0x29124f51, 0x291299e0, 0x2912e6ac,
+    0x28133599, 0x2813868f, 0x2813d974, 0x28142e31, 0x281484ae, 0x2814dcd6,
+    0x27153695, 0x271591d5, 0x2715ee85, 0x27164c92, 0x2716abec, 0x27170c82,
+    0x26176e46, 0x2617d128, 0x2618351b, 0x26189a11, 0x26190000, 0x261966db,
+    0x2619ce96, 0x391a19cc, 0x3919b340, 0x38194d9c, 0x3818e8eb, 0x38188539,
+    0x38182292, 0x3817c103, 0x38176099, 0x38170164, 0x3716a372, 0x371646d4,
+    0x3715eb99, 0x371591d5, 0x37153999, 0x3714e2f8, 0x36148e08, 0x36143add,
+    0x3613e98d, 0x36139a30, 0x36134cde, 0x351301af, 0x3512b8be, 0x35127224,
+    0x35122dfe, 0x3511ec67, 0x3411ad7c, 0x34117159, 0x3411381c, 0x341101e2,
+    0x3310cec8, 0x33109eeb, 0x33107267, 0x32104958, 0x321023d8, 0x32100200,
+    0x310fe3e7, 0x310fc9a4, 0x310fb348, 0x310fa0e5, 0x300f928a, 0x300f8840,
+    0x300f8210, 0x2f0f8000, 0x2f0f8210, 0x2f0f8840, 0x2e0f928a, 0x2e0fa0e5,
+    0x2e0fb348, 0x2d0fc9a4, 0x2d0fe3e7, 0x2d100200, 0x2c1023d8, 0x2c104958,
+    0x2c107267, 0x2c109eeb, 0x2b10cec8, 0x2b1101e2, 0x2b11381c, 0x2a117159,
+    0x2a11ad7c, 0x2a11ec67, 0x2a122dfe, 0x2a127224, 0x2912b8be, 0x291301af,
+    0x29134cde, 0x29139a30, 0x2813e98d, 0x28143add, 0x28148e08, 0x2814e2f8,
+    0x28153999, 0x281591d5, 0x2715eb99, 0x271646d4, 0x2716a372, 0x27170164,
+    0x27176099, 0x2717c103, 0x26182292, 0x26188539, 0x2618e8eb, 0x26194d9c,
+    0x2619b340, 0x261a19cc, 0x381a6698, 0x381a013b, 0x38199ccd, 0x38193958,
+    0x3818d6e8, 0x3818758b, 0x3818154c, 0x3817b639, 0x37175861, 0x3716fbd3,
+    0x3716a09e, 0x371646d4, 0x3715ee85, 0x371597c3, 0x361542a2, 0x3614ef36,
+    0x36149d93, 0x36144dcf, 0x36140000, 0x3513b43d, 0x35136a9f, 0x3513233e,
+    0x3512de33, 0x35129b98, 0x34125b89, 0x34121e20, 0x3411e378, 0x3411abac,
+    0x331176d9, 0x33114519, 0x33111688, 0x3310eb3f, 0x3210c358, 0x32109eeb,
+    0x32107e0f, 0x311060db, 0x31104761, 0x311031b3, 0x30101fe0, 0x301011f6,
+    0x301007fe, 0x30100200, 0x2f100000, 0x2f100200, 0x2f1007fe, 0x2e1011f6,
+    0x2e101fe0, 0x2e1031b3, 0x2d104761, 0x2d1060db, 0x2d107e0f, 0x2d109eeb,
+    0x2c10c358, 0x2c10eb3f, 0x2c111688, 0x2b114519, 0x2b1176d9, 0x2b11abac,
+    0x2b11e378, 0x2a121e20, 0x2a125b89, 0x2a129b98, 0x2a12de33, 0x2913233e,
+    0x29136a9f, 0x2913b43d, 0x29140000, 0x29144dcf, 0x28149d93, 0x2814ef36,
+    0x281542a2, 0x281597c3, 0x2815ee85, 0x281646d4, 0x2716a09e, 0x2716fbd3,
+    0x27175861, 0x2717b639, 0x2718154c, 0x2718758b, 0x2718d6e8, 0x26193958,
+    0x26199ccd, 0x261a013b, 0x261a6698, 0x381ab4ed, 0x381a50be, 0x3819ed83,
+    0x38198b49, 0x38192a1a, 0x3818ca03, 0x38186b11, 0x37180d52, 0x3717b0d3,
+    0x371755a3, 0x3716fbd3, 0x3716a372, 0x37164c92, 0x3615f744, 0x3615a39b,
+    0x361551aa, 0x36150186, 0x3614b343, 0x361466f7, 0x35141cb8, 0x3513d49e,
+    0x35138ebf, 0x35134b35, 0x34130a18, 0x3412cb82, 0x34128f8b, 0x3412564e,
+    0x34121fe4, 0x3311ec67, 0x3311bbf1, 0x33118e9b, 0x3211647d, 0x32113dae,
+    0x32111a46, 0x3210fa59, 0x3110ddfc, 0x3110c540, 0x3110b036, 0x30109eeb,
+    0x3010916b, 0x301087c0, 0x301081f0, 0x2f108000, 0x2f1081f0, 0x2f1087c0,
+    0x2e10916b, 0x2e109eeb, 0x2e10b036, 0x2d10c540, 0x2d10ddfc, 0x2d10fa59,
+    0x2d111a46, 0x2c113dae, 0x2c11647d, 0x2c118e9b, 0x2b11bbf1, 0x2b11ec67,
+    0x2b121fe4, 0x2b12564e, 0x2a128f8b, 0x2a12cb82, 0x2a130a18, 0x2a134b35,
+    0x2a138ebf, 0x2913d49e, 0x29141cb8, 0x291466f7, 0x2914b343, 0x29150186,
+    0x281551aa, 0x2815a39b, 0x2815f744, 0x28164c92, 0x2816a372, 0x2816fbd3,
+    0x271755a3, 0x2717b0d3, 0x27180d52, 0x27186b11, 0x2718ca03, 0x27192a1a,
+    0x27198b49, 0x2619ed83, 0x261a50be, 0x261ab4ed, 0x381b04bd, 0x381aa1ba,
+    0x381a3fb2, 0x3819deb0, 0x38197ebf, 0x38191fec, 0x3718c243, 0x371865d3,
+    0x37180aa8, 0x3717b0d3, 0x37175861, 0x37170164, 0x3616abec, 0x3616580a,
+    0x361605d1, 0x3615b553, 0x361566a4, 0x361519d8, 0x3514cf04, 0x3514863d,
+    0x35143f9b, 0x3513fb33, 0x3513b91c, 0x3413796e, 0x34133c42, 0x341301af,
+    0x3412c9ce, 0x331294b6, 0x33126281, 0x33123345, 0x3312071b, 0x3211de19,
+    0x3211b855, 0x321195e4, 0x321176d9, 0x31115b47, 0x3111433f, 0x31112ecf,
+    0x30111e04, 0x301110e9, 0x30110786, 0x301101e2, 0x2f110000, 0x2f1101e2,
+    0x2f110786, 0x2e1110e9, 0x2e111e04, 0x2e112ecf, 0x2d11433f, 0x2d115b47,
+    0x2d1176d9, 0x2d1195e4, 0x2c11b855, 0x2c11de19, 0x2c12071b, 0x2c123345,
+    0x2b126281, 0x2b1294b6, 0x2b12c9ce, 0x2b1301af, 0x2a133c42, 0x2a13796e,
+    0x2a13b91c, 0x2a13fb33, 0x29143f9b, 0x2914863d, 0x2914cf04, 0x291519d8,
+    0x291566a4, 0x2915b553, 0x281605d1, 0x2816580a, 0x2816abec, 0x28170164,
+    0x28175861, 0x2817b0d3, 0x27180aa8, 0x271865d3, 0x2718c243, 0x27191fec,
+    0x27197ebf, 0x2719deb0, 0x271a3fb2, 0x261aa1ba, 0x261b04bd, 0x381b55fc,
+    0x381af423, 0x381a934b, 0x381a337e, 0x3819d4c8, 0x37197736, 0x37191ad3,
+    0x3718bfad, 0x371865d3, 0x37180d52, 0x3717b639, 0x37176099, 0x36170c82,
+    0x3616ba05, 0x36166933, 0x36161a1f, 0x3615ccdc, 0x3515817d, 0x35153817,
+    0x3514f0be, 0x3514ab87, 0x35146888, 0x341427d8, 0x3413e98d, 0x3413adbd,
+    0x34137480, 0x34133dec, 0x33130a18, 0x3312d91c, 0x3312ab0c, 0x33128000,
+    0x3212580c, 0x32123345, 0x321211be, 0x3211f38a, 0x3111d8b9, 0x3111c15a,
+    0x3111ad7c, 0x30119d2a, 0x3011906d, 0x3011874f, 0x301181d4, 0x2f118000,
+    0x2f1181d4, 0x2f11874f, 0x2e11906d, 0x2e119d2a, 0x2e11ad7c, 0x2e11c15a,
+    0x2d11d8b9, 0x2d11f38a, 0x2d1211be, 0x2c123345, 0x2c12580c, 0x2c128000,
+    0x2c12ab0c, 0x2b12d91c, 0x2b130a18, 0x2b133dec, 0x2b137480, 0x2a13adbd,
+    0x2a13e98d, 0x2a1427d8, 0x2a146888, 0x2a14ab87, 0x2914f0be, 0x29153817,
+    0x2915817d, 0x2915ccdc, 0x29161a1f, 0x28166933, 0x2816ba05, 0x28170c82,
+    0x28176099, 0x2817b639, 0x28180d52, 0x281865d3, 0x2718bfad, 0x27191ad3,
+    0x27197736, 0x2719d4c8, 0x271a337e, 0x271a934b, 0x271af423, 0x261b55fc,
+    0x381ba89c, 0x381b47ec, 0x381ae841, 0x381a89a7, 0x371a2c29, 0x3719cfd3,
+    0x371974b2, 0x37191ad3, 0x3718c243, 0x37186b11, 0x3718154c, 0x3617c103,
+    0x36176e46, 0x36171d25, 0x3616cdb3, 0x36168000, 0x3616341f, 0x3515ea24,
+    0x3515a220, 0x35155c2a, 0x35151853, 0x3514d6b3, 0x3414975d, 0x34145a67,
+    0x34141fe7, 0x3413e7f2, 0x3313b29d, 0x33138000, 0x3313502e, 0x3313233e,
+    0x3212f942, 0x3212d250, 0x3212ae7a, 0x32128dd1, 0x31127068, 0x3112564e,
+    0x31123f90, 0x31122c3b, 0x30121c5b, 0x30120ff9, 0x3012071b, 0x301201c7,
+    0x2f120000, 0x2f1201c7, 0x2f12071b, 0x2e120ff9, 0x2e121c5b, 0x2e122c3b,
+    0x2e123f90, 0x2d12564e, 0x2d127068, 0x2d128dd1, 0x2d12ae7a, 0x2c12d250,
+    0x2c12f942, 0x2c13233e, 0x2c13502e, 0x2b138000, 0x2b13b29d, 0x2b13e7f2,
+    0x2b141fe7, 0x2a145a67, 0x2a14975d, 0x2a14d6b3, 0x2a151853, 0x2a155c2a,
+    0x2915a220, 0x2915ea24, 0x2916341f, 0x29168000, 0x2916cdb3, 0x28171d25,
+    0x28176e46, 0x2817c103, 0x2818154c, 0x28186b11, 0x2818c243, 0x28191ad3,
+    0x271974b2, 0x2719cfd3, 0x271a2c29, 0x271a89a7, 0x271ae841, 0x271b47ec,
+    0x271ba89c, 0x381bfc92, 0x381b9d08, 0x381b3e88, 0x371ae11e, 0x371a84d4,
+    0x371a29b7, 0x3719cfd3, 0x37197736, 0x37191fec, 0x3718ca03, 0x3618758b,
+    0x36182292, 0x3617d128, 0x3617815d, 0x36173341, 0x3616e6e7, 0x35169c60,
+    0x351653be, 0x35160d13, 0x3515c874, 0x351585f3, 0x341545a5, 0x3415079d,
+    0x3414cbf0, 0x341492b3, 0x34145bf9, 0x331427d8, 0x3313f664, 0x3313c7b1,
+    0x33139bd2, 0x321372db, 0x32134cde, 0x321329ed, 0x32130a18, 0x3112ed70,
+    0x3112d403, 0x3112bdde, 0x3112ab0c, 0x30129b98, 0x30128f8b, 0x301286ea,
+    0x301281bb, 0x2f128000, 0x2f1281bb, 0x2f1286ea, 0x2e128f8b, 0x2e129b98,
+    0x2e12ab0c, 0x2e12bdde, 0x2d12d403, 0x2d12ed70, 0x2d130a18, 0x2d1329ed,
+    0x2c134cde, 0x2c1372db, 0x2c139bd2, 0x2c13c7b1, 0x2b13f664, 0x2b1427d8,
+    0x2b145bf9, 0x2b1492b3, 0x2a14cbf0, 0x2a15079d, 0x2a1545a5, 0x2a1585f3,
+    0x2a15c874, 0x29160d13, 0x291653be, 0x29169c60, 0x2916e6e7, 0x29173341,
+    0x2917815d, 0x2817d128, 0x28182292, 0x2818758b, 0x2818ca03, 0x28191fec,
+    0x28197736, 0x2819cfd3, 0x271a29b7, 0x271a84d4, 0x271ae11e, 0x271b3e88,
+    0x271b9d08, 0x271bfc92, 0x381c51d2, 0x381bf36b, 0x371b9613, 0x371b39d5,
+    0x371adebc, 0x371a84d4, 0x371a2c29, 0x3719d4c8, 0x37197ebf, 0x36192a1a,
+    0x3618d6e8, 0x36188539, 0x3618351b, 0x3617e69d, 0x361799d1, 0x35174ec7,
+    0x35170590, 0x3516be3e, 0x351678e2, 0x35163590, 0x3515f45a, 0x3415b553,
+    0x3415788e, 0x34153e1e, 0x34150617, 0x3314d08d, 0x33149d93, 0x33146d3c,
+    0x33143f9b, 0x331414c2, 0x3213ecc4, 0x3213c7b1, 0x3213a59a, 0x3213868f,
+    0x31136a9f, 0x311351d6, 0x31133c42, 0x311329ed, 0x30131ae0, 0x30130f22,
+    0x301306bb, 0x301301af, 0x2f130000, 0x2f1301af, 0x2f1306bb, 0x2e130f22,
+    0x2e131ae0, 0x2e1329ed, 0x2e133c42, 0x2d1351d6, 0x2d136a9f, 0x2d13868f,
+    0x2d13a59a, 0x2c13c7b1, 0x2c13ecc4, 0x2c1414c2, 0x2c143f9b, 0x2b146d3c,
+    0x2b149d93, 0x2b14d08d, 0x2b150617, 0x2b153e1e, 0x2a15788e, 0x2a15b553,
+    0x2a15f45a, 0x2a163590, 0x2a1678e2, 0x2916be3e, 0x29170590, 0x29174ec7,
+    0x291799d1, 0x2917e69d, 0x2918351b, 0x28188539, 0x2818d6e8, 0x28192a1a,
+    0x28197ebf, 0x2819d4c8, 0x281a2c29, 0x281a84d4, 0x271adebc, 0x271b39d5,
+    0x271b9613, 0x271bf36b, 0x271c51d2, 0x371ca84f, 0x371c4b09, 0x371beed6,
+    0x371b93c1, 0x371b39d5, 0x371ae11e, 0x371a89a7, 0x371a337e, 0x3619deb0,
+    0x36198b49, 0x36193958, 0x3618e8eb, 0x36189a11, 0x36184cda, 0x35180155,
+    0x3517b793, 0x35176fa3, 0x35172998, 0x3516e581, 0x3516a372, 0x3416637c,
+    0x341625b1, 0x3415ea24, 0x3415b0e6, 0x34157a0b, 0x331545a5, 0x331513c6,
+    0x3314e480, 0x3314b7e6, 0x32148e08, 0x321466f7, 0x321442c4, 0x3214217e,
+    0x32140333, 0x3113e7f2, 0x3113cfc6, 0x3113babb, 0x3113a8dc, 0x30139a30,
+    0x30138ebf, 0x3013868f, 0x301381a4, 0x2f138000, 0x2f1381a4, 0x2f13868f,
+    0x2e138ebf, 0x2e139a30, 0x2e13a8dc, 0x2e13babb, 0x2d13cfc6, 0x2d13e7f2,
+    0x2d140333, 0x2d14217e, 0x2c1442c4, 0x2c1466f7, 0x2c148e08, 0x2c14b7e6,
+    0x2c14e480, 0x2b1513c6, 0x2b1545a5, 0x2b157a0b, 0x2b15b0e6, 0x2a15ea24,
+    0x2a1625b1, 0x2a16637c, 0x2a16a372, 0x2a16e581, 0x2a172998, 0x29176fa3,
+    0x2917b793, 0x29180155, 0x29184cda, 0x29189a11, 0x2918e8eb, 0x28193958,
+    0x28198b49, 0x2819deb0, 0x281a337e, 0x281a89a7, 0x281ae11e, 0x281b39d5,
+    0x271b93c1, 0x271beed6, 0x271c4b09, 0x271ca84f, 0x371d0000, 0x371ca3d7,
+    0x371c48c6, 0x371beed6, 0x371b9613, 0x371b3e88, 0x371ae841, 0x361a934b,
+    0x361a3fb2, 0x3619ed83, 0x36199ccd, 0x36194d9c, 0x36190000, 0x3618b407,
+    0x351869c2, 0x3518213e, 0x3517da8d, 0x351795bf, 0x351752e5, 0x3417120f,
+    0x3416d34f, 0x341696b6, 0x34165c56, 0x3416243f, 0x3315ee85, 0x3315bb37,
+    0x33158a69, 0x33155c2a, 0x3315308b, 0x3215079d, 0x3214e170, 0x3214be12,
+    0x32149d93, 0x31148000, 0x31146565, 0x31144dcf, 0x31143948, 0x301427d8,
+    0x30141989, 0x30140e61, 0x30140665, 0x3014019a, 0x2f140000, 0x2f14019a,
+    0x2f140665, 0x2e140e61, 0x2e141989, 0x2e1427d8, 0x2e143948, 0x2e144dcf,
+    0x2d146565, 0x2d148000, 0x2d149d93, 0x2d14be12, 0x2c14e170, 0x2c15079d,
+    0x2c15308b, 0x2c155c2a, 0x2b158a69, 0x2b15bb37, 0x2b15ee85, 0x2b16243f,
+    0x2b165c56, 0x2a1696b6, 0x2a16d34f, 0x2a17120f, 0x2a1752e5, 0x2a1795bf,
+    0x2917da8d, 0x2918213e, 0x291869c2, 0x2918b407, 0x29190000, 0x29194d9c,
+    0x28199ccd, 0x2819ed83, 0x281a3fb2, 0x281a934b, 0x281ae841, 0x281b3e88,
+    0x281b9613, 0x281beed6, 0x271c48c6, 0x271ca3d7, 0x271d0000, 0x371d58d9,
+    0x371cfdcb, 0x371ca3d7, 0x371c4b09, 0x371bf36b, 0x371b9d08, 0x361b47ec,
+    0x361af423, 0x361aa1ba, 0x361a50be, 0x361a013b, 0x3619b340, 0x361966db,
+    0x35191c19, 0x3518d30b, 0x35188bbe, 0x35184644, 0x351802ab, 0x3517c103,
+    0x3417815d, 0x341743c9, 0x34170858, 0x3416cf1a, 0x34169821, 0x3316637c,
+    0x3316313d, 0x33160174, 0x3315d431, 0x3315a985, 0x3215817d, 0x32155c2a,
+    0x32153999, 0x321519d8, 0x3114fcf4, 0x3114e2f8, 0x3114cbf0, 0x3114b7e6,
+    0x3014a6e1, 0x301498eb, 0x30148e08, 0x3014863d, 0x2f148190, 0x2f148000,
+    0x2f148190, 0x2f14863d, 0x2f148e08, 0x2e1498eb, 0x2e14a6e1, 0x2e14b7e6,
+    0x2e14cbf0, 0x2d14e2f8, 0x2d14fcf4, 0x2d1519d8, 0x2d153999, 0x2c155c2a,
+    0x2c15817d, 0x2c15a985, 0x2c15d431, 0x2c160174, 0x2b16313d, 0x2b16637c,
+    0x2b169821, 0x2b16cf1a, 0x2b170858, 0x2a1743c9, 0x2a17815d, 0x2a17c103,
+    0x2a1802ab, 0x2a184644, 0x29188bbe, 0x2918d30b, 0x29191c19, 0x291966db,
+    0x2919b340, 0x291a013b, 0x281a50be, 0x281aa1ba, 0x281af423, 0x281b47ec,
+    0x281b9d08, 0x281bf36b, 0x281c4b09, 0x271ca3d7, 0x271cfdcb, 0x271d58d9,
+    0x371db2d0, 0x371d58d9, 0x371d0000, 0x371ca84f, 0x371c51d2, 0x361bfc92,
+    0x361ba89c, 0x361b55fc, 0x361b04bd, 0x361ab4ed, 0x361a6698, 0x361a19cc,
+    0x3519ce96, 0x35198505, 0x35193d26, 0x3518f709, 0x3518b2bc, 0x3518704f,
+    0x34182fd0, 0x3417f151, 0x3417b4e0, 0x34177a8d, 0x34174268, 0x34170c82,
+    0x3316d8ea, 0x3316a7af, 0x331678e2, 0x33164c92, 0x321622cd, 0x3215fba2,
+    0x3215d720, 0x3215b553, 0x32159648, 0x31157a0b, 0x311560a8, 0x31154a28,
+    0x31153695, 0x301525f6, 0x30151853, 0x30150db2, 0x30150617, 0x2f150186,
+    0x2f150000, 0x2f150186, 0x2f150617, 0x2f150db2, 0x2e151853, 0x2e1525f6,
+    0x2e153695, 0x2e154a28, 0x2d1560a8, 0x2d157a0b, 0x2d159648, 0x2d15b553,
+    0x2c15d720, 0x2c15fba2, 0x2c1622cd, 0x2c164c92, 0x2c1678e2, 0x2b16a7af,
+    0x2b16d8ea, 0x2b170c82, 0x2b174268, 0x2b177a8d, 0x2a17b4e0, 0x2a17f151,
+    0x2a182fd0, 0x2a18704f, 0x2a18b2bc, 0x2a18f709, 0x29193d26, 0x29198505,
+    0x2919ce96, 0x291a19cc, 0x291a6698, 0x291ab4ed, 0x281b04bd, 0x281b55fc,
+    0x281ba89c, 0x281bfc92, 0x281c51d2, 0x281ca84f, 0x281d0000, 0x271d58d9,
+    0x271db2d0
+};
+
+#endif
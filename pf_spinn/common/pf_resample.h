@@ -0,0 +1,96 @@
+
+//! resampling from a set of normalised particle weights
+//!
+//! a set of n draws is made with one uniform offset u shared by everyone
+//! taking part, draw k being the particle at which the cumulative weight
+//! first exceeds (k + u) / n (systematic). with a uniform of its own for
+//! every draw it is stratified. residual resampling first gives every
+//! particle floor(n w) of the draws and then draws the rest systematically
+//! from the remainders. each draw is one scan of the weights, so a particle
+//! core or an aggregator can make only its own draw, and a host making all n
+//! draws can do it in one scan (pf_host/pf_resample.h).
+//!
+//! order maps the position of a particle in the shared order to its index
+//! in w (NULL if they are the same), for cores that store the particles in
+//! a different order to each other. the state type is PF_STATE_T
+//! (pf_state.h). the header does not depend on pf_store.h, so the aggregator
+//! can use it alongside its own packet layout.
+
+#ifndef __PF_RESAMPLE_H__
+#define __PF_RESAMPLE_H__
+
+#include "pf_state.h"
+
+typedef enum pf_resample_scheme {
+    PF_RESAMPLE_SYSTEMATIC = 0, PF_RESAMPLE_STRATIFIED = 1,
+    PF_RESAMPLE_RESIDUAL = 2
+} pf_resample_scheme;
+
+//! \brief the same 15 bit number on every core for the same step
+//! \param[in] step: a counter shared by all cores (e.g. the update count)
+//! \return a number in [0, 0x7FFF]
+static inline uint32_t pf_shared_random(uint32_t step) {
+
+    uint32_t s = step * 0x9E3779B9u + 0x7F4A7C15u;
+    s ^= s >> 16;
+    s *= 0x85EBCA6Bu;
+    s ^= s >> 13;
+    return s & 0x7FFF;
+
+}
+
+//! \brief draw k of n
+//! \param[in] scheme: PF_RESAMPLE_SYSTEMATIC, _STRATIFIED or _RESIDUAL
+//! \param[in] w: the normalised weights
+//! \param[in] order: the index in w of each position, or NULL
+//! \param[in] n: the number of particles (and of draws)
+//! \param[in] k: the draw to make, in [0, n)
+//! \param[in] u: in [0, 1). the shared offset, or this draw's own number if
+//!     stratified
+//! \return the index in w of the particle drawn
+static inline uint32_t pf_resample_draw(pf_resample_scheme scheme,
+        const pf_state_t *w, const uint32_t *order, uint32_t n, uint32_t k,
+        pf_state_t u) {
+
+    pf_state_t nt = (pf_state_t)(int)n;
+    uint32_t i;
+
+    if(scheme == PF_RESAMPLE_RESIDUAL) {
+
+        //the draws given out by floor(n w)
+        uint32_t given = 0;
+        for(i = 0; i < n; i++) {
+            given += (uint32_t)(int)(nt * w[order ? order[i] : i]);
+            if(given > k)
+                return order ? order[i] : i;
+        }
+
+        //the rest against the remainders, which add up to n - given
+        pf_state_t target = (pf_state_t)(int)(k - given) + u;
+        pf_state_t sum = 0;
+        for(i = 0; i < n; i++) {
+            pf_state_t res = nt * w[order ? order[i] : i];
+            sum += res - (pf_state_t)(int)res;
+            if(sum > target)
+                break;
+        }
+
+    } else {
+
+        pf_state_t target = ((pf_state_t)(int)k + u) / nt;
+        pf_state_t sum = 0;
+        for(i = 0; i < n; i++) {
+            sum += w[order ? order[i] : i];
+            if(sum > target)
+                break;
+        }
+
+    }
+
+    //rounding can leave the total just short of the last target
+    if(i == n) i--;
+    return order ? order[i] : i;
+
+}
+
+#endif
@@ -0,0 +1,18 @@
+
+//! the numeric type of the particle states
+//!
+//! define PF_STATE_T before including this (or a header that includes it) to
+//! choose the state type: accum on SpiNNaker, float by default.
+
+#ifndef __PF_STATE_H__
+#define __PF_STATE_H__
+
+#include <stdint.h>
+
+#ifndef PF_STATE_T
+#define PF_STATE_T float
+#endif
+
+typedef PF_STATE_T pf_state_t;
+
+#endif
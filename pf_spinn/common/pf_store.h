@@ -0,0 +1,83 @@
+
+//! the particle states of a particle filter as flat arrays
+//!
+//! the states are one block of 4 * n values, x[0..n) y[0..n) r[0..n) w[0..n),
+//! and the packed XR/YW states received from the other particles are two
+//! blocks of PACKETS_PER_PARTICLE * n words, one being filled while the
+//! other is processed. swapping them swaps an index, not the data.
+//!
+//! the header is plain C with no SpiNNaker dependencies. before including it
+//! define PF_STATE_T as the state type (accum on SpiNNaker, float by default)
+//! and PF_MALLOC as the allocator (spin1_malloc on SpiNNaker, malloc by
+//! default).
+
+#ifndef __PF_STORE_H__
+#define __PF_STORE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pf_state.h"
+
+#ifndef PF_MALLOC
+#include <stdlib.h>
+#define PF_MALLOC malloc
+#endif
+
+#define PACKETS_PER_PARTICLE 2
+typedef enum packet_identifiers{
+    XR_IND = 0, YW_IND = 1
+} packet_identifiers;
+
+typedef struct pf_store_t {
+    uint32_t n;
+    pf_state_t *x;
+    pf_state_t *y;
+    pf_state_t *r;
+    pf_state_t *w;
+    uint32_t *packets[2];
+    uint32_t proc;
+} pf_store_t;
+
+//! \brief allocates the states of n particles
+//! \param[in] store: the store to initialise
+//! \param[in] n: the number of particles
+//! \return bool true if successful, false if out of memory
+static inline bool pf_store_initialise(pf_store_t *store, uint32_t n) {
+
+    pf_state_t *states = (pf_state_t *)PF_MALLOC(4 * n * sizeof(pf_state_t));
+    uint32_t *packets = (uint32_t *)PF_MALLOC(
+        2 * PACKETS_PER_PARTICLE * n * sizeof(uint32_t));
+    if(!states || !packets)
+        return false;
+
+    store->n = n;
+    store->x = states;
+    store->y = states + n;
+    store->r = states + 2 * n;
+    store->w = states + 3 * n;
+    store->packets[0] = packets;
+    store->packets[1] = packets + PACKETS_PER_PARTICLE * n;
+    store->proc = 0;
+
+    return true;
+}
+
+//! \brief the packets being processed
+static inline uint32_t *pf_store_proc(pf_store_t *store) {
+    return store->packets[store->proc];
+}
+
+//! \brief the packets being received
+static inline uint32_t *pf_store_work(pf_store_t *store) {
+    return store->packets[store->proc ^ 1];
+}
+
+//! \brief hands the received packets over for processing
+static inline void pf_store_swap(pf_store_t *store) {
+    store->proc ^= 1;
+}
+
+//! \brief the index of packet ind (XR_IND or YW_IND) of particle i
+#define PF_PACKET(i, ind) ((i) * PACKETS_PER_PARTICLE + (ind))
+
+#endif
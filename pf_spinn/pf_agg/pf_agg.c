@@ -9,6 +9,8 @@
 #include <debug.h>
 #include <circular_buffer.h>
 
+#include "pf_resample.h"
+
 #define PACKETS_PER_PARTICLE 6
 #define RECORDING_DATA_REGION_ID 0
 
@@ -49,7 +51,9 @@ static data_items_t resampled_data;
 static data_items_t average_data;
 static circular_buffer particle_buffer;
 static data_items_t *particle_data;
+static float *particle_weights;
 static uint32_t maximum_n = 0;
+static uint32_t resample_step = 0;
 
 //! key bases offsets
 typedef enum packet_identifiers{
@@ -205,6 +209,7 @@ void normalise() {
 
     for(uint32_t i = 0; i < n_particles; i++) {
         particle_data[i].w *= total;
+        particle_weights[i] = particle_data[i].w;
         sumsqr += particle_data[i].w * particle_data[i].w;
     }
 
@@ -272,9 +277,12 @@ void send_position_out()
 
 void resample() {
 
+    //every aggregator sees the same weights and calls this once a round, so
+    //the step (and the offset drawn from it) is the same on all of them
+    float rn = (float)pf_shared_random(resample_step++) * (1.0f / 32768.0f);
+
     if(sumsqr * n_particles > 2.0f && maximum_n > 4) {
 
-        float rn = 1.0 * (double)rand() / RAND_MAX;
         if(rn > 1.0) {
 
             //set resampled data to random values
@@ -287,14 +295,11 @@ void resample() {
 
         } else {
 
-            //set resampled according to distribution of weights
-            float accumed_sum = 0.0;
-            uint32_t j = 0;
-            for(j = 0; j < n_particles; j++) {
-                accumed_sum += particle_data[j].w;
-                if(accumed_sum > rn) break;
-            }
-            resampled_data = particle_data[j];
+            //set resampled according to distribution of weights. every
+            //aggregator has the same rn, so each makes the draw of its
+            //partner from one systematic resampling
+            resampled_data = particle_data[pf_resample_draw(PF_RESAMPLE_SYSTEMATIC,
+                particle_weights, NULL, n_particles, partner_i, rn)];
 
         }
 
@@ -442,6 +447,11 @@ static bool read_reception_region(address_t address){
     //! create data holder for particles
     particle_data =
         (data_items_t*) spin1_malloc(n_keys * sizeof(data_items_t));
+    particle_weights = (float*) spin1_malloc(n_keys * sizeof(float));
+    if(!reception_base_keys || !particle_data || !particle_weights) {
+        log_error("not enough space to store the particles");
+        return false;
+    }
 
     //! store n particles
     n_particles = n_keys;
@@ -14,11 +14,25 @@
 
 #include <stdfix.h>
 
+#define PF_STATE_T accum
+#define PF_MALLOC spin1_malloc
+#include "pf_store.h"
+#include "pf_resample.h"
+
+//with PF_POLAR_LUT the distance and angular bucket of each event are read
+//from one table (28.9 KB of DTCM) instead of LUT_SQRT and approxatan2
+#ifdef PF_POLAR_LUT
+#define PF_POLAR_LUT_CONST
+#include "pf_polar_lut.h"
+#endif
+
 #define MY_RAND int_to_accum(spin1_rand() & 0x00007FFF)
 #define NEG_BIAS_CONSTANT 40.74k //2.0 * 64 / pi r^2
 
 #define X_MASK(x) (accum)((x>>1)&0x1FF)
 #define Y_MASK(y) (accum)((y>>12)&0xFF)
+#define X_PIXEL(x) (int32_t)((x>>1)&0x1FF)
+#define Y_PIXEL(y) (int32_t)((y>>12)&0xFF)
 #define XY_CODE(x, y) ((x&0x1FF)<<1)|((y&0xFF)<<12)
 
 #define XR_BITPACK(x, r) ((r&0x000FFFC0)>>6 | (x&0x00FFFFC0)<<8)
@@ -47,6 +61,7 @@
 #define K_PI 3.14159265359k
 #define K_PI_4 0.78539816k	/* pi/4 */
 #define LOG_COUNTER_PERIOD 1000000
+#define RESAMPLE_SCHEME PF_RESAMPLE_SYSTEMATIC
 
 
 
@@ -86,11 +101,7 @@ static uint32_t event_window[EVENT_WINDOW_SIZE];
 static uint32_t start_window = 0;
 static uint32_t size_window = 0;
 
-#define N_PARTICLE_STATES 4
-typedef enum state_identifiers {
-    X_IND = 0, Y_IND = 1, R_IND = 2, W_IND = 3
-} state_identifiers;
-static accum **p_states;
+static pf_store_t p_states;
 
 static accum *LUT_SQRT;
 static accum L[ANG_BUCKETS];
@@ -107,6 +118,8 @@ static accum n = 0.0f;
 
 static accum target[TARGET_ELEMENTS];
 static uint32_t random_part_i;
+static uint32_t *resample_order;
+static uint32_t resample_step = 0;
 
 //! SENDING/RECEIVING VARIABLES
 
@@ -120,17 +133,11 @@ static uint32_t my_p2p_id;
 
 static uint32_t n_particles;
 static uint32_t last_index;
-static uint32_t **proc_data, **work_data;
 static circular_buffer retina_buffer;
 
 static uint32_t full_buffer;
 static uint32_t my_turn;
 
-#define PACKETS_PER_PARTICLE 2
-typedef enum packet_identifiers{
-    XR_IND = 0, YW_IND = 1
-} packet_identifiers;
-
 
 //! DEBUG VARIABLES
 static uint32_t received_count = 0;
@@ -193,7 +200,8 @@ void receive_retina_event(uint key, uint payload) {
 void receive_particle_data_packet(uint key, uint payload) {
 
     //load in data
-    work_data[packets_received++ / PACKETS_PER_PARTICLE][key&0x1] = payload;
+    pf_store_work(&p_states)[PF_PACKET(packets_received++ /
+        PACKETS_PER_PARTICLE, key&0x1)] = payload;
 
     if(packets_received == my_turn) { //it is our turn to send data
         tried_to_call_my_turn = true;
@@ -203,9 +211,7 @@ void receive_particle_data_packet(uint key, uint payload) {
 
     if(packets_received == full_buffer) { //perform update
 
-        uint32_t **temp = work_data;
-        work_data = proc_data;
-        proc_data = temp;
+        pf_store_swap(&p_states);
 
         packets_received = 0;
 
@@ -303,26 +309,23 @@ void send_position_out()
 //! \brief move local particle data into particle array data
 void load_state_into_table() {
 
-//    work_data[last_index][X_IND] = x;
-//    work_data[last_index][Y_IND] = y;
-//    work_data[last_index][R_IND] = r;
-//    work_data[last_index][W_IND] = w;
-
-    p_states[last_index][X_IND] = x;
-    p_states[last_index][Y_IND] = y;
-    p_states[last_index][R_IND] = r;
-    p_states[last_index][W_IND] = w;
+    p_states.x[last_index] = x;
+    p_states.y[last_index] = y;
+    p_states.r[last_index] = r;
+    p_states.w[last_index] = w;
 
 }
 
 void unpack_p_states() {
 
+    uint32_t *proc_data = pf_store_proc(&p_states);
     for(uint32_t i = 0; i < n_particles - 1; i++) {
-        p_states[i][X_IND] = int_to_accum(X_BITUNPACK(proc_data[i][XR_IND]));
-        p_states[i][R_IND] = int_to_accum(R_BITUNPACK(proc_data[i][XR_IND]))
-            + MIN_RADIUS;
-        p_states[i][Y_IND] = int_to_accum(Y_BITUNPACK(proc_data[i][YW_IND]));
-        p_states[i][W_IND] = int_to_accum(W_BITUNPACK(proc_data[i][YW_IND]));
+        uint32_t xr = proc_data[PF_PACKET(i, XR_IND)];
+        uint32_t yw = proc_data[PF_PACKET(i, YW_IND)];
+        p_states.x[i] = int_to_accum(X_BITUNPACK(xr));
+        p_states.r[i] = int_to_accum(R_BITUNPACK(xr)) + MIN_RADIUS;
+        p_states.y[i] = int_to_accum(Y_BITUNPACK(yw));
+        p_states.w[i] = int_to_accum(W_BITUNPACK(yw));
     }
 
     load_state_into_table();
@@ -337,36 +340,34 @@ void normalise() {
     accum total = 0.0k;
 
     for(uint32_t i = 0; i < n_particles; i++) {
-        total += p_states[i][W_IND];
+        total += p_states.w[i];
     }
     total = 1.0k / total;
 
     for(uint32_t i = 0; i < n_particles; i++) {
-        p_states[i][W_IND] *= total;
-        target[0] += p_states[i][X_IND] * p_states[i][W_IND];
-        target[1] += p_states[i][Y_IND] * p_states[i][W_IND];
-        target[2] += p_states[i][R_IND] * p_states[i][W_IND];
+        p_states.w[i] *= total;
+        target[0] += p_states.x[i] * p_states.w[i];
+        target[1] += p_states.y[i] * p_states.w[i];
+        target[2] += p_states.r[i] * p_states.w[i];
     }
 
 }
 
-//! \brief find a random particle to unload (this is the resample step)
+//! \brief find a random particle to unload (this is the resample step).
+//!     the particles together make the n draws of one resampling, this
+//!     particle making draw my_p2p_id with an offset shared by all of them
 void unload_weighted_random_particle() {
 
-    accum rn = MY_RAND;
+    accum rn = int_to_accum(pf_shared_random(resample_step++));
+    if(RESAMPLE_SCHEME == PF_RESAMPLE_STRATIFIED) rn = MY_RAND;
 
-    //set resampled according to distribution of weights
-    accum accumed_sum = 0.0;
-    for(random_part_i = 0; random_part_i < n_particles; random_part_i++) {
-        accumed_sum += p_states[random_part_i][W_IND];
-        if(accumed_sum > rn) break;
-    }
-    if(random_part_i == n_particles) random_part_i--;
+    random_part_i = pf_resample_draw(RESAMPLE_SCHEME, p_states.w,
+        resample_order, n_particles, my_p2p_id, rn);
 
-    x = p_states[random_part_i][X_IND];
-    y = p_states[random_part_i][Y_IND];
-    r = p_states[random_part_i][R_IND];
-    w = p_states[random_part_i][W_IND];
+    x = p_states.x[random_part_i];
+    y = p_states.y[random_part_i];
+    r = p_states.r[random_part_i];
+    w = p_states.w[random_part_i];
 
 //    static int divisor = 0;
 //    if(divisor++ % DIV_VALUE == 0) {
@@ -451,13 +452,30 @@ void calculate_likelihood() {
 
 
     //calculate the likelihood;
-    accum dx, dy, D2, D, ABSDR, cval;
+    accum D, ABSDR, cval;
     uint32_t L_i;
+#ifdef PF_POLAR_LUT
+    int32_t px = (int32_t)(x + 0.5k), py = (int32_t)(y + 0.5k);
+    int32_t qdx, qdy;
+    uint32_t polar;
+#else
+    accum dx, dy, D2;
+#endif
 
     uint32_t count = 0;
     uint32_t i = start_window;
     while(count < size_window) {
 
+#ifdef PF_POLAR_LUT
+        qdx = X_PIXEL(event_window[i]) - px;
+        qdy = Y_PIXEL(event_window[i]) - py;
+
+        if((uint32_t)(qdx + PF_POLAR_HALF) < PF_POLAR_SIZE &&
+                (uint32_t)(qdy + PF_POLAR_HALF) < PF_POLAR_SIZE) {
+
+            polar = pf_polar_lut[PF_POLAR_INDEX(qdx, qdy)];
+            D = int_to_accum(PF_POLAR_DIST_BITS(polar));
+#else
         dx = X_MASK(event_window[i]) - x;
         dy = Y_MASK(event_window[i]) - y;
 //        dx = r+0.01;
@@ -467,13 +485,18 @@ void calculate_likelihood() {
         if(D2 <= MAX_RADIUS_PLUS2_SQRD) {
 
             D = LUT_SQRT[(uint32_t)(D2+0.5k)];
+#endif
 
             if(D < r + INLIER_PAR_PLUS1) {
                 if(D > r) ABSDR = D - r;
                 else ABSDR = r - D;
 
                 if(ABSDR <= INLIER_PAR_PLUS1) {
+#ifdef PF_POLAR_LUT
+                    L_i = PF_POLAR_BUCKET(polar);
+#else
                     L_i = (uint32_t)(0.5k + 10.026769884k * (approxatan2(dy, dx) + K_PI));
+#endif
                     cval = ABSDR < 1.0k ? 1.0k : (INLIER_PAR_PLUS1 - ABSDR)*INV_INLIER_PAR;
                     if(cval > L[L_i]) {
                         score = (score + cval) - L[L_i];
@@ -512,9 +535,9 @@ void particle_filter_update_step(uint do_p2p, uint do_calc) {
 //    if(divisor++ % DIV_VALUE == 0) {
 //        log_debug("==========");
 //        for(uint32_t i = 0; i < n_particles; i++) {
-//            log_debug("[%d %d %d] W:%d.%d%d", (int)p_states[i][X_IND], (int)p_states[i][Y_IND],
-//            (int)p_states[i][R_IND], (int)(p_states[i][W_IND]*100),
-//            (int)(p_states[i][W_IND]*1000)%10, (int)(p_states[i][W_IND]*10000)%10);
+//            log_debug("[%d %d %d] W:%d.%d%d", (int)p_states.x[i], (int)p_states.y[i],
+//            (int)p_states.r[i], (int)(p_states.w[i]*100),
+//            (int)(p_states.w[i]*1000)%10, (int)(p_states.w[i]*10000)%10);
 //        }
 //        log_debug("==========");
 //        //log_debug("Target: [%d %d]", (int)x_target, (int)y_target);
@@ -757,23 +780,30 @@ bool initialize(uint32_t *timer_period) {
         return false;
     }
 
-    proc_data = spin1_malloc(n_particles * sizeof(uint32_t*));
-    work_data = spin1_malloc(n_particles * sizeof(uint32_t*));
-    p_states = spin1_malloc(n_particles * sizeof(accum*));
+    if(!pf_store_initialise(&p_states, n_particles)) {
+        log_error("not enough space to create p2p data");
+        return false;
+    }
+
+    //the others are stored in p2p id order and this particle last, so each
+    //core sees a different order. resampling uses the p2p id order
+    resample_order = spin1_malloc(n_particles * sizeof(uint32_t));
+    if(!resample_order) {
+        log_error("not enough space to create resampling order");
+        return false;
+    }
     for(uint32_t i = 0; i < n_particles; i++) {
-        proc_data[i] = spin1_malloc(PACKETS_PER_PARTICLE * sizeof(uint32_t));
-        work_data[i] = spin1_malloc(PACKETS_PER_PARTICLE * sizeof(uint32_t));
-        p_states[i] = spin1_malloc(N_PARTICLE_STATES * sizeof(accum));
-        if(!proc_data[i] || !work_data[i] || !p_states[i]) {
-            log_error("not enough space to create p2p data");
-            return false;
-        }
+        if(i < my_p2p_id) resample_order[i] = i;
+        else if(i == my_p2p_id) resample_order[i] = last_index;
+        else resample_order[i] = i - 1;
     }
 
+#ifndef PF_POLAR_LUT
     uint32_t n_indices = MAX_RADIUS_PLUS2_SQRD + 1;
     LUT_SQRT = spin1_malloc(n_indices * sizeof(accum));
     for(uint32_t i = 0; i < n_indices; i++)
             LUT_SQRT[i] = sqrtk((accum)i);
+#endif
 
 
     load_state_into_table();
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_AEDECODE__
+#define __ICUB_ARMTRACE_AEDECODE__
+
+#include <iCub/eventdriven/all.h>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  IN-PLACE AE DECODING
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//decodes the packed words of one event list into a single reused event and
+//hands it to f. returns the number of events
+template <typename E, typename F>
+inline unsigned int decodeEach(const yarp::os::Bottle *packed, E &e, F &f)
+{
+    if(!packed) return 0;
+
+    unsigned int n = 0;
+    int pos = 0;
+    while(pos < packed->size() && e.decode(*packed, pos)) {
+        f(static_cast<const ev::AE &>(e));
+        n++;
+    }
+
+    return n;
+}
+
+//calls f(const ev::AE &) for every address event in the bottle, including the
+//GaussianAE output of the tracker, without materialising a vQueue: there is
+//no allocation or reference counting per event. the AE passed to f is only
+//valid for the duration of the call
+template <typename F>
+inline unsigned int forEachAE(const ev::vBottle &bot, F f)
+{
+    const yarp::os::Bottle &b = bot;
+    ev::AE ae;
+    ev::GaussianAE gae;
+
+    unsigned int n = decodeEach(b.find(ev::AE::tag).asList(), ae, f);
+    n += decodeEach(b.find(ev::GaussianAE::tag).asList(), gae, f);
+
+    return n;
+}
+
+#endif
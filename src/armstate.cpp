@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "armstate.h"
+
+bool vArmStateReader::open(const std::string &name, const std::string &remote)
+{
+    this->useCallback();
+
+    if(!yarp::os::BufferedPort<yarp::sig::Vector>::open(name)) {
+        yError() << "Could not open: " << name;
+        return false;
+    }
+
+    if(!yarp::os::Network::connect(remote + "/state:o", name, "udp")) {
+        yError() << "Could not connect to" << remote + "/state:o";
+        return false;
+    }
+
+    return true;
+}
+
+void vArmStateReader::onRead(yarp::sig::Vector &state)
+{
+    if(state.size() < 7) return;
+
+    double d[8];
+    for(int i = 0; i < 7; i++)
+        d[i] = state[i];
+    d[7] = yarp::os::Time::now();
+
+    slot.write(d);
+}
+
+bool vArmStateReader::getPose(yarp::sig::Vector &x, yarp::sig::Vector &o,
+                              double timeout) const
+{
+    double d[8];
+    if(!slot.read(d)) return false;
+    if(yarp::os::Time::now() - d[7] > timeout) return false;
+
+    x.resize(3);
+    o.resize(4);
+    for(int i = 0; i < 3; i++)
+        x[i] = d[i];
+    for(int i = 0; i < 4; i++)
+        o[i] = d[3 + i];
+
+    return true;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_ARMSTATE__
+#define __ICUB_ARMTRACE_ARMSTATE__
+
+#include <yarp/os/all.h>
+#include "lockfree.h"
+
+#define ARM_STATE_TIMEOUT   0.5     // [s]
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM STATE READER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//keeps the latest hand pose streamed by the cartesian controller on its
+//state:o port ([x y z ax ay az theta]) so it can be read without an RPC
+class vArmStateReader : public yarp::os::BufferedPort<yarp::sig::Vector>
+{
+private:
+
+    //pose (7) and the local time it was received
+    vSeqlock<8> slot;
+
+public:
+
+    bool open(const std::string &name, const std::string &remote);
+    void onRead(yarp::sig::Vector &state);
+
+    //returns false if no pose has been received within the timeout
+    bool getPose(yarp::sig::Vector &x, yarp::sig::Vector &o,
+                 double timeout = ARM_STATE_TIMEOUT) const;
+
+};
+
+#endif
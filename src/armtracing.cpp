@@ -16,6 +16,9 @@
 
 #include "armtracing.h"
 #include "yarp/math/Math.h"
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
 
 using namespace yarp::math;
 using namespace ev;
@@ -46,116 +49,592 @@ int main(int argc, char * argv[])
 }
 
 /*//////////////////////////////////////////////////////////////////////////////
-  VBOTTLE READER/PROCESSOR
+  TARGET MAILBOX
   ////////////////////////////////////////////////////////////////////////////*/
 
-vArmTraceController::vArmTraceController()
+vTargetMailbox::vTargetMailbox()
+{
+    average = false;
+    for(int d = 0; d < 3; d++)
+        sum[d] = fetchedsum[d] = 0;
+    fetchedn = 0;
+    posted = 0;
+    fetched = 0;
+    dropped = 0;
+}
+
+void vTargetMailbox::setAveraging(bool average)
+{
+    this->average = average;
+}
+
+void vTargetMailbox::post(const yarp::sig::Vector &x,
+                          const yarp::os::Stamp &st)
 {
+    for(int d = 0; d < 3; d++)
+        sum[d] += x[d];
+    unsigned int n = posted + 1;
+
+    double s[9] = {x[0], x[1], x[2], (double)st.getCount(), st.getTime(),
+                   sum[0], sum[1], sum[2], (double)n};
+    slot.write(s);
+    posted = n;
+}
+
+bool vTargetMailbox::fetch(yarp::sig::Vector &x, yarp::os::Stamp &st)
+{
+    //everything posted since the last fetch
+    double s[9];
+    if(!slot.read(s)) return false;
+    double n = s[8] - fetchedn;
+    if(n <= 0) return false;
+
+    for(int d = 0; d < 3; d++)
+        x[d] = average ? (s[5 + d] - fetchedsum[d]) / n : s[d];
+    if(!average)
+        dropped += (unsigned int)n - 1;
+    st = yarp::os::Stamp((int)s[3], s[4]);
+    for(int d = 0; d < 3; d++)
+        fetchedsum[d] = s[5 + d];
+    fetchedn = s[8];
+    fetched++;
+
+    return true;
+}
+
+void vTargetMailbox::counts(unsigned int &posted, unsigned int &fetched,
+                            unsigned int &dropped) const
+{
+    posted = this->posted;
+    fetched = this->fetched;
+    dropped = this->dropped;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM COMMAND THREAD
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vArmCommandThread::vArmCommandThread() : RateThread(CTRL_THREAD_PER * 1000)
+{
+    side = RIGHT_ARM;
+    rtpriority = 0;
+    cpu = -1;
+    mailbox = 0;
+    stats = 0;
+    armstate = 0;
+    arm = 0;
+    scope = 0;
+    reachmap = 0;
 
     //inital gaze
     xrobref.resize(3);
     xrobref[0]=-0.4; //x = -0.4 (distance infront -ive)
     xrobref[1]=0; //y = 0 (left-right)
     xrobref[2]=0.3; //z = 0.3 (up/down)
-    px.resize(2);
-    px[0] = medy;
-    px[1] = 127 - medx;
+    od.resize(4);
+    params.deadband = CMD_DEADBAND;
+    params.trajtime = TRAJ_TIME;
+    params.predict = false;
+    params.alpha = PRED_ALPHA;
+    params.beta = PRED_BETA;
+    params.lead = PRED_LEAD;
+    pending = params;
+    changed = false;
+    lastcmd.resize(3, 0.0);
+    commanded = false;
+    sent = 0;
+    suppressed = 0;
+    clamped = 0;
 
 }
 
+void vArmCommandThread::setSide(int side)
+{
+    this->side = side;
+}
 
-/******************************************************************************/
-bool vArmTraceController::open(const std::string &name)
+void vArmCommandThread::setScheduling(int rtpriority, int cpu)
 {
-    //and open the input port
+    this->rtpriority = rtpriority;
+    this->cpu = cpu;
+}
 
-    this->useCallback();
+void vArmCommandThread::setPredictor(bool enable, double alpha, double beta,
+                                     double lead)
+{
+    pm.lock();
+    pending.predict = enable;
+    pending.alpha = alpha;
+    pending.beta = beta;
+    pending.lead = lead;
+    changed = true;
+    pm.unlock();
+}
 
-    std::string vInPortName = name + "/vBottle:i";
-    if(!yarp::os::BufferedPort<ev::vBottle>::open(vInPortName)) {
-        std::cerr << "Could not open: " << vInPortName << std::endl;
-        return false;
+void vArmCommandThread::setDeadband(double deadband)
+{
+    pm.lock();
+    pending.deadband = deadband;
+    changed = true;
+    pm.unlock();
+}
+
+void vArmCommandThread::setTrajTime(double trajtime)
+{
+    pm.lock();
+    pending.trajtime = trajtime;
+    changed = true;
+    pm.unlock();
+}
+
+vCommandParams vArmCommandThread::getParams()
+{
+    pm.lock();
+    vCommandParams p = pending;
+    pm.unlock();
+    return p;
+}
+
+void vArmCommandThread::applyParams()
+{
+    pm.lock();
+    vCommandParams p = pending;
+    changed = false;
+    pm.unlock();
+
+    predictor.setGains(p.alpha, p.beta);
+    if(p.predict && !params.predict)
+        predictor.reset();
+    if(p.trajtime != params.trajtime)
+        arm->setTrajTime(p.trajtime);
+
+    params = p;
+}
+
+void vArmCommandThread::setReachMap(const vReachMap *reachmap)
+{
+    this->reachmap = reachmap;
+}
+
+void vArmCommandThread::counts(unsigned int &sent,
+                               unsigned int &suppressed) const
+{
+    sent = this->sent;
+    suppressed = this->suppressed;
+}
+
+void vArmCommandThread::attach(vTargetMailbox *mailbox,
+                               vLatencyStats *stats,
+                               vArmStateReader *armstate,
+                               vArmDevice *arm,
+                               vScopePublisher *scope)
+{
+    this->mailbox = mailbox;
+    this->stats = stats;
+    this->armstate = armstate;
+    this->arm = arm;
+    this->scope = scope;
+}
+
+bool vArmCommandThread::threadInit()
+{
+    //failing to get the requested scheduling (e.g. without CAP_SYS_NICE) is
+    //not fatal: the thread runs with the default policy
+    if(rtpriority > 0) {
+        sched_param sp;
+        sp.sched_priority = rtpriority;
+        int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp);
+        if(err)
+            yWarning() << armPart(side) << "command thread: could not set"
+                       << "SCHED_FIFO priority" << rtpriority << "-"
+                       << std::strerror(err);
+        else
+            yInfo() << armPart(side) << "command thread: SCHED_FIFO priority"
+                    << rtpriority;
     }
 
-    if(!scopeport.open(name + "/scope:o")) {
-        yError() << "Could not open scope port";
-        return false;
+    if(cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        int err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        if(err)
+            yWarning() << armPart(side) << "command thread: could not pin"
+                       << "to cpu" << cpu << "-" << std::strerror(err);
+        else
+            yInfo() << armPart(side) << "command thread: pinned to cpu" << cpu;
+    }
+
+    return true;
+}
+
+void vArmCommandThread::run()
+{
+    if(changed) applyParams();
+
+    //only act if a new target has arrived since the last cycle
+    yarp::os::Stamp st;
+    if(!mailbox->fetch(xrobref, st)) return;
+
+    double t1 = yarp::os::Time::now();
+    if(!armstate || !armstate->getPose(handpos, handor))
+        arm->getPose(handpos, handor);
+    double t2 = yarp::os::Time::now();
+    stats->record(vLatencyStats::GETPOSE, t2 - t1);
+
+    //the scope is written asynchronously at its own rate
+    scope->post(handpos, xrobref, st);
+    double t3 = yarp::os::Time::now();
+    stats->record(vLatencyStats::SCOPE, t3 - t2);
+
+    //command where the target will be once the command takes effect: the
+    //age of the observation plus a configurable lead
+    if(params.predict) {
+        double ts = st.isValid() ? st.getTime() : t1;
+        predictor.update(xrobref, ts);
+        predictor.predict(t3 - ts + params.lead, xrobref);
     }
 
-    yarp::os::Property options;
-    options.put("device", "gazecontrollerclient");
-    options.put("local", name);
-    options.put("remote", "/iKinGazeCtrl");
-    gazedriver.open(options);
-    if(gazedriver.isValid())
-        gazedriver.view(gazecontrol);
+
+    // we need to add an offset and possibly a scaling factor to x, to keep thehand in the reaching space of the arm without moving the torso so much
+
+
+    // we need to add an offset to off-centre the movement to avoid interference with the torso and the movement backward
+
+    // we keep the orientation of the left arm constant:
+    // we want the middle finger to point forward (end-effector x-axis)
+    // with the palm turned between down and right (end-effector y-axis points leftward);
+    // to achieve that it is enough to rotate the root frame of pi around z-axis
+
+    if(side == LEFT_ARM) {
+        // left hand rotation
+        od[0]=0.0; od[1]=-0.5; od[2]=1.0; od[3]=M_PI;
+    } else {
+        // right hand rotation
+        od[0]=0.0; od[1]=-1.5; od[2]=1.0; od[3]=M_PI;
+    }
+
+    // go to the target :)
+    // (in streaming)
+    //arm->goToPose(xrobref,od);
+    xrobref[1] += side == LEFT_ARM ? -ARM_Y_OFFSET : ARM_Y_OFFSET;
+
+    //the solver only gets targets it can reach
+    if(reachmap && reachmap->clamp(xrobref))
+        clamped++;
+
+    //don't bother the controller with movements smaller than the deadband
+    double dx = xrobref[0] - lastcmd[0];
+    double dy = xrobref[1] - lastcmd[1];
+    double dz = xrobref[2] - lastcmd[2];
+    if(commanded && dx * dx + dy * dy + dz * dz <
+            params.deadband * params.deadband) {
+        suppressed++;
+        return;
+    }
+
+    arm->goToPosition(xrobref);
+    double t4 = yarp::os::Time::now();
+    stats->record(vLatencyStats::GOTO, t4 - t3);
+    if(st.isValid())
+        stats->record(vLatencyStats::COMMAND, t4 - st.getTime());
+
+    for(int i = 0; i < 3; i++)
+        lastcmd[i] = xrobref[i];
+    commanded = true;
+    sent++;
+
+    // some verbosity
+    // printStatus();
+
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  VBOTTLE READER/PROCESSOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the cartesian controller of an arm
+static std::string armRemote(int side)
+{
+    return std::string("/icub/cartesianController/") + armPart(side);
+}
+
+vArmTraceController::vArmTraceController()
+{
+    medx = 0;
+    medy = 0;
+    gaze = 0;
+    for(int i = 0; i < N_ARMS; i++)
+        arm[i] = 0;
+    simulate = false;
+    simlatency = SIM_LATENCY;
+    narms = 1;
+    replaying = false;
+    backlog = BACKLOG_LATEST;
+    maxpending = MAX_PENDING;
+    received = 0;
+    skipped = 0;
+    collapsed = 0;
+    overflowed = 0;
+    depth = 0;
+    maxdepth = 0;
+    period = CTRL_THREAD_PER;
+    scopeperiod = SCOPE_PER;
+    localprojector = 0;
+    localprojection = true;
+    eyeperiod = EYE_POSE_PER;
+    targetdepth = TARGET_DEPTH;
+    px.resize(2, 0.0);
+    target.resize(3, 0.0);
+}
+
+vArmTraceController::~vArmTraceController()
+{
+    for(int i = 0; i < N_ARMS; i++)
+        delete arm[i];
+    delete gaze;
+}
+
+void vArmTraceController::setSimulation(bool simulate, double latency)
+{
+    this->simulate = simulate;
+    simlatency = latency;
+}
+
+void vArmTraceController::setBimanual(bool bimanual)
+{
+    narms = bimanual ? N_ARMS : 1;
+    selector.enable(LEFT_ARM, bimanual);
+}
+
+void vArmTraceController::setControlPeriod(double period)
+{
+    this->period = period;
+}
+
+void vArmTraceController::setScheduling(int rtpriority,
+                                        const yarp::os::Value &cpus)
+{
+    //cpus is either a single cpu for all arms or a list with one per arm
+    for(int i = 0; i < N_ARMS; i++) {
+        int cpu = -1;
+        if(cpus.isList()) {
+            if(i < cpus.asList()->size())
+                cpu = cpus.asList()->get(i).asInt();
+        } else if(cpus.isInt()) {
+            cpu = cpus.asInt();
+        }
+        commandthread[i].setScheduling(rtpriority, cpu);
+    }
+}
+
+void vArmTraceController::setReplaying(bool replaying)
+{
+    this->replaying = replaying;
+}
+
+bool vArmTraceController::setBacklogPolicy(const std::string &policy,
+                                           int maxpending)
+{
+    if(maxpending < 1) {
+        yError() << "maxpending must be at least 1";
+        return false;
+    }
+    this->maxpending = maxpending;
+
+    if(policy == "process")
+        backlog = BACKLOG_PROCESS;
+    else if(policy == "latest")
+        backlog = BACKLOG_LATEST;
+    else if(policy == "collapse")
+        backlog = BACKLOG_COLLAPSE;
     else {
-        yError() << "Gaze Driver not opened and will not be used";
+        yError() << "Unknown backlog policy" << policy
+                 << "(process | latest | collapse)";
         return false;
     }
-    options.put("device","cartesiancontrollerclient");
-    // left arm
-    //    options.put("remote","/icubSim/cartesianController/left_arm");
-    //    options.put("local","/cartesian_client/left_arm");
-    //right arm
-    options.put("remote","/icub/cartesianController/right_arm");
-    options.put("local","/cartesian_client/right_arm");
-
-    // let's give the controller some time to warm up
-    bool ok=false;
-    double t0=yarp::os::Time::now();
-    while (yarp::os::Time::now()-t0<10.0)
-    {
-        // this might fail if controller
-        // is not connected to solver yet
-        if (client.open(options))
-        {
-            ok=true;
-            break;
-        }
+    return true;
+}
+
+void vArmTraceController::setProjection(bool local, double eyeperiod,
+                                        double depth)
+{
+    localprojection = local;
+    this->eyeperiod = eyeperiod;
+    targetdepth = depth;
+}
+
+void vArmTraceController::setScopePeriod(double period)
+{
+    scopeperiod = period;
+}
+
+void vArmTraceController::setPredictor(bool enable, double alpha, double beta,
+                                       double lead)
+{
+    for(int i = 0; i < N_ARMS; i++)
+        commandthread[i].setPredictor(enable, alpha, beta, lead);
+}
 
-        yarp::os::Time::delay(1.0);
+void vArmTraceController::setCommandFilter(double deadband, bool average)
+{
+    for(int i = 0; i < N_ARMS; i++) {
+        commandthread[i].setDeadband(deadband);
+        mailbox[i].setAveraging(average);
     }
+}
 
-    if (!ok)
-    {
-        yError()<<"Unable to open the Cartesian Controller";
+void vArmTraceController::setRecording(const std::string &filename)
+{
+    recordfile = filename;
+}
+
+void vArmTraceController::setReachMap(const std::string &prefix)
+{
+    reachprefix = prefix;
+}
+
+void vArmTraceController::setEstimatorWindow(double window,
+                                             unsigned int capacity)
+{
+    estimator.configure(window, capacity);
+}
+
+/******************************************************************************/
+bool vArmTraceController::open(const std::string &name)
+{
+    double t0 = yarp::os::Time::now();
+
+    //the right arm keeps the single arm port names
+    std::string armname[N_ARMS];
+    armname[RIGHT_ARM] = name;
+    armname[LEFT_ARM] = name + "/left";
+
+    for(int i = 0; i < narms; i++)
+        if(!scope[i].open(armname[i] + "/scope:o", scopeperiod))
+            return false;
+
+    if(!recordfile.empty() && !recorder.open(recordfile))
         return false;
+
+    double t1 = yarp::os::Time::now();
+    if(!openDevices(name))
+        return false;
+    double t2 = yarp::os::Time::now();
+
+    //project pixels locally from a cached eye pose if possible
+    if(localprojection) {
+        if(projector.initialise(gaze, 1, eyeperiod) && projector.start())
+            localprojector = &projector;
+        else
+            yWarning() << "Local projection unavailable: using get3DPoint";
     }
 
-    // open the view
-    client.view(arm);
+    //the reachability maps are stored as <prefix>_<part>.bin
+    if(!reachprefix.empty()) {
+        for(int i = 0; i < narms; i++) {
+            if(!reachmap[i].open(reachprefix + "_" + armPart(i) + ".bin",
+                                 armPart(i)))
+                return false;
+            commandthread[i].setReachMap(&reachmap[i]);
+        }
+    }
 
-    // latch the controller context in order to preserve
-    // it after closing the module
-    // the context contains the dofs status, the tracking mode,
-    // the resting positions, the limits and so on.
-    arm->storeContext(&startup_context_id);
+    //each arm is only commanded from its own control thread, so that the
+    //latency of one controller never delays the other
+    for(int i = 0; i < narms; i++) {
+
+        //read the hand pose from the controller stream if possible
+        vArmStateReader *a = &armstate[i];
+        if(simulate || !armstate[i].open(armname[i] + "/armstate:i",
+                                         armRemote(i))) {
+            yWarning() << armPart(i)
+                       << "state stream unavailable: using getPose";
+            a = 0;
+        }
 
-    // set trajectory time
-    arm->setTrajTime(1.0);
+        commandthread[i].setSide(i);
+        commandthread[i].attach(&mailbox[i], &stats, a, arm[i], &scope[i]);
+        commandthread[i].setRate(period * 1000);
+        if(!commandthread[i].start()) {
+            yError() << "Could not start the" << armPart(i)
+                     << "command thread";
+            return false;
+        }
+    }
 
-    // get the torso dofs
-    yarp::sig::Vector newDof, curDof;
-    arm->getDOF(curDof);
-    newDof=curDof;
+    //and open the input port last, as process() uses all of the above. a
+    //replay is the only input, so the port is not opened and onRead never
+    //competes with it
+    if(!replaying) {
+        this->useCallback();
+        this->setStrict();
+
+        std::string vInPortName = name + "/vBottle:i";
+        if(!yarp::os::BufferedPort<ev::vBottle>::open(vInPortName)) {
+            std::cerr << "Could not open: " << vInPortName << std::endl;
+            return false;
+        }
+    }
 
-    // enable the torso yaw and pitch
-    // disable the torso roll
-    newDof[0]=0;
-    newDof[1]=0;
-    newDof[2]=0;
+    yInfo() << "Startup: ports" << t1 - t0 << "s | devices" << t2 - t1
+            << "s | threads" << yarp::os::Time::now() - t2 << "s";
+    yInfo()<<"Thread started successfully";
 
-    // send the request for dofs reconfiguration
-    arm->setDOF(newDof,curDof);
+    return true;
+}
 
-    // impose some restriction on the torso pitch
-    limitTorsoPitch();
+bool vArmTraceController::openDevices(const std::string &name)
+{
+    if(simulate) {
+        gaze = new vSimGaze(simlatency);
+        for(int i = 0; i < narms; i++)
+            arm[i] = new vSimArm(simlatency, i);
+    } else {
+        gaze = new vIKinGaze();
+        for(int i = 0; i < narms; i++)
+            arm[i] = new vCartesianArm();
+    }
 
-    xd.resize(3);
-    od.resize(4);
+    //the gaze and arm clients connect at the same time
+    bool gazeok = false;
+    std::thread gazeopener([&]() {
+        gazeok = gaze->open(name, "/iKinGazeCtrl");
+    });
+
+    bool armok[N_ARMS];
+    std::thread armopener[N_ARMS];
+    for(int i = 0; i < narms; i++) {
+        armopener[i] = std::thread([&, i]() {
+            armok[i] = arm[i]->open(std::string("/cartesian_client/") +
+                                    armPart(i), armRemote(i));
+        });
+    }
 
-    yInfo()<<"Thread started successfully";
+    bool ok = true;
+    gazeopener.join();
+    ok = ok && gazeok;
+    for(int i = 0; i < narms; i++) {
+        armopener[i].join();
+        ok = ok && armok[i];
+    }
+    return ok;
+}
+
+bool vArmTraceController::buildReachMaps(const std::string &name,
+                                         const std::string &prefix,
+                                         double res)
+{
+    //only the controllers are opened: no port or thread can command the arms
+    //while the solver is queried
+    if(!openDevices(name))
+        return false;
+
+    for(int i = 0; i < narms; i++) {
+        if(!vReachMap::build(arm[i], armPart(i), res,
+                             prefix + "_" + armPart(i) + ".bin"))
+            return false;
+    }
 
     return true;
 }
@@ -169,134 +648,251 @@ void vArmTraceController::interrupt()
 
 void vArmTraceController::close()
 {
-    // we require an immediate stop
-    // before closing the client for safety reason
-    arm->stopControl();
+    //stop commanding before we stop the arms
+    for(int i = 0; i < N_ARMS; i++)
+        if(commandthread[i].isRunning()) commandthread[i].stop();
+    if(projector.isRunning()) projector.stop();
+    for(int i = 0; i < N_ARMS; i++) {
+        armstate[i].close();
+        scope[i].close();
+    }
 
-    // it's a good rule to restore the controller
-    // context as it was before opening the module
-    arm->restoreContext(startup_context_id);
+    //stops the arms and restores the controller contexts
+    for(int i = 0; i < N_ARMS; i++)
+        if(arm[i]) arm[i]->close();
+    if(gaze) gaze->close();
 
-    client.close();
     std::cout << "Closing Event Manager" << std::endl;
     yarp::os::BufferedPort<ev::vBottle>::close();
+    recorder.close();
     std::cout << "Closed Event Manager" << std::endl;
 }
 
-void vArmTraceController::limitTorsoPitch()
+void vArmTraceController::printStatus()
 {
-    int axis=0; // pitch joint
-    double min, max;
+    yInfo() << "input:" << received << "bottles" << skipped << "skipped"
+            << collapsed << "collapsed" << overflowed << "overflowed |"
+            << "queue depth" << depth << "( max" << maxdepth << ")";
+
+    unsigned int posted, fetched, dropped, sent, suppressed, written, lost;
+    for(int i = 0; i < narms; i++) {
+        mailbox[i].counts(posted, fetched, dropped);
+        commandthread[i].counts(sent, suppressed);
+        scope[i].counts(written, lost);
+
+        yInfo() << armPart(i) << "targets:" << posted << "posted" << dropped
+                << "dropped" << fetched << "fetched"
+                << commandthread[i].clampedTargets() << "clamped |"
+                << "commands:" << sent << "sent" << suppressed << "suppressed |"
+                << "scope:" << written << "written" << lost << "dropped";
+    }
+    stats.print();
+}
 
-    // sometimes it may be helpful to reduce
-    // the range of variability of the joints;
-    // for example here we don't want the torso
-    // to lean out more than 30 degrees forward
+void vArmTraceController::report(yarp::os::Bottle &b)
+{
+    unsigned int posted, fetched, dropped, sent, suppressed, written;
+
+    yarp::os::Bottle &input = b.addList();
+    input.addString("input");
+    input.addInt(received);
+    input.addInt(skipped);
+    input.addInt(collapsed);
+    input.addInt(depth);
+    input.addInt(maxdepth);
+    input.addInt(overflowed);
+
+    //one list of each per arm in bimanual mode
+    for(int i = 0; i < narms; i++) {
+        mailbox[i].counts(posted, fetched, dropped);
+        yarp::os::Bottle &targets = b.addList();
+        targets.addString(i == RIGHT_ARM ? "targets" :
+                          std::string("targets_") + armPart(i));
+        targets.addInt(posted);
+        targets.addInt(fetched);
+        targets.addInt(dropped);
+    }
 
-    // we keep the lower limit
-    arm->getLimits(axis,&min,&max);
-    arm->setLimits(axis,min,MAX_TORSO_PITCH);
-}
+    for(int i = 0; i < narms; i++) {
+        commandthread[i].counts(sent, suppressed);
+        yarp::os::Bottle &commands = b.addList();
+        commands.addString(i == RIGHT_ARM ? "commands" :
+                           std::string("commands_") + armPart(i));
+        commands.addInt(sent);
+        commands.addInt(suppressed);
+    }
 
-//void vArmTraceController::printStatus()
-//{
-//    if (t-t1>=PRINT_STATUS_PER)
-//    {
-//        yarp::sig::Vector x,o,xdhat,odhat,qdhat;
+    for(int i = 0; i < narms; i++) {
+        scope[i].counts(written, dropped);
+        yarp::os::Bottle &samples = b.addList();
+        samples.addString(i == RIGHT_ARM ? "scope" :
+                          std::string("scope_") + armPart(i));
+        samples.addInt(written);
+        samples.addInt(dropped);
+    }
 
-//        // we get the current arm pose in the
-//        // operational space
-//        if (!arm->getPose(x,o))
-//            return;
+    stats.report(b);
+}
 
-//        // we get the final destination of the arm
-//        // as found by the solver: it differs a bit
-//        // from the desired pose according to the tolerances
-//        if (!arm->getDesired(xdhat,odhat,qdhat))
-//            return;
+void vArmTraceController::parameters(yarp::os::Bottle &b)
+{
+    vCommandParams p = commandthread[RIGHT_ARM].getParams();
+
+    yarp::os::Bottle *l = &b.addList();
+    l->addString("period"); l->addDouble(period);
+    l = &b.addList();
+    l->addString("trajtime"); l->addDouble(p.trajtime);
+    l = &b.addList();
+    l->addString("deadband"); l->addDouble(p.deadband);
+    l = &b.addList();
+    l->addString("scopeperiod"); l->addDouble(scopeperiod);
+    l = &b.addList();
+    l->addString("predict"); l->addInt(p.predict ? 1 : 0);
+    l = &b.addList();
+    l->addString("gains"); l->addDouble(p.alpha); l->addDouble(p.beta);
+    l = &b.addList();
+    l->addString("lead"); l->addDouble(p.lead);
+}
 
-//        double e_x=norm(xdhat-x);
-//        double e_o=norm(odhat-o);
+bool vArmTraceController::tune(const yarp::os::Bottle &command,
+                               yarp::os::Bottle &reply)
+{
+    if(command.get(0).asString() == "get") {
+        parameters(reply);
+        return true;
+    }
 
-//        yInfo()<<"+++++++++";
-//        yInfo()<<"xd          [m] = "<<xd.toString();
-//        yInfo()<<"xdhat       [m] = "<<xdhat.toString();
-//        yInfo()<<"x           [m] = "<<x.toString();
-//        yInfo()<<"od        [rad] = "<<od.toString();
-//        yInfo()<<"odhat     [rad] = "<<odhat.toString();
-//        yInfo()<<"o         [rad] = "<<o.toString();
-//        yInfo()<<"norm(e_x)   [m] = "<<e_x;
-//        yInfo()<<"norm(e_o) [rad] = "<<e_o;
-//        yInfo()<<"---------";
+    //set <param> <value> [<value>]
+    std::string param = command.get(1).asString();
+    yarp::os::Value v1 = command.get(2);
+    yarp::os::Value v2 = command.get(3);
+    if(!v1.isDouble() && !v1.isInt()) {
+        reply.addString("missing value");
+        return false;
+    }
+    double d = v1.asDouble();
+
+    //every arm gets the same values
+    if(param == "period" && d > 0) {
+        period = d;
+        for(int i = 0; i < narms; i++)
+            commandthread[i].setRate(period * 1000);
+    } else if(param == "trajtime" && d > 0) {
+        for(int i = 0; i < narms; i++)
+            commandthread[i].setTrajTime(d);
+    } else if(param == "deadband" && d >= 0) {
+        for(int i = 0; i < narms; i++)
+            commandthread[i].setDeadband(d);
+    } else if(param == "scopeperiod" && d > 0) {
+        scopeperiod = d;
+        for(int i = 0; i < narms; i++)
+            scope[i].setRate(scopeperiod * 1000);
+    } else if(param == "predict" || param == "gains" || param == "lead") {
+        vCommandParams p = commandthread[RIGHT_ARM].getParams();
+        if(param == "predict") {
+            p.predict = d != 0;
+        } else if(param == "gains") {
+            if(!v2.isDouble() && !v2.isInt()) {
+                reply.addString("gains needs alpha and beta");
+                return false;
+            }
+            p.alpha = d;
+            p.beta = v2.asDouble();
+        } else {
+            p.lead = d;
+        }
+        for(int i = 0; i < narms; i++)
+            commandthread[i].setPredictor(p.predict, p.alpha, p.beta, p.lead);
+    } else {
+        reply.addString("unknown parameter or bad value");
+        return false;
+    }
 
-//        t1=t;
-//    }
-//}
+    reply.addString("ok");
+    parameters(reply);
+    return true;
+}
+
+void vArmTraceController::resetStats()
+{
+    stats.reset();
+    maxdepth = 0;
+}
 
 
 
 /******************************************************************************/
 void vArmTraceController::onRead(vBottle &inputBottle)
 {
-
     yarp::os::Stamp st;
     this->getEnvelope(st);
+    if(recorder.isOpen())
+        recorder.record(inputBottle, st, yarp::os::Time::now());
 
-    //we just need to get our updated TS
-    vQueue q = inputBottle.get<AE>();
-    if(q.empty()) return;
-
-    auto vc = is_event<AE>(q.back());
+    //bottles that arrived while we were busy are still waiting in the port
+    input(inputBottle, st, this->getPendingReads());
+}
 
-    px[0] = 303 - vc->x;
-    px[1] = 239 - vc->y;
-    //turn u/v into xyz
-    if(gazedriver.isValid()) {
-        gazecontrol->get3DPoint(1, px, 0.3, xrobref);
-        std::cout << px.toString() << " " << xrobref.toString() << std::endl;
+/******************************************************************************/
+void vArmTraceController::input(vBottle &inputBottle,
+                                const yarp::os::Stamp &st, int pending)
+{
+    depth = pending;
+    if(pending > maxdepth) maxdepth = pending;
+    received++;
+
+    //this is the oldest bottle waiting: let it go so the queue drains
+    if(pending > maxpending) {
+        overflowed++;
+        return;
     }
 
-    yarp::os::Bottle &scopedata = scopeport.prepare();
-    scopedata.clear();
-    yarp::sig::Vector handpos, handor;
-    arm->getPose(handpos, handor);
-
-    scopedata.addDouble(handpos[0]);
-    scopedata.addDouble(handpos[1]);
-    scopedata.addDouble(handpos[2]);
-
-    scopedata.addDouble(xrobref[0]);
-    scopedata.addDouble(xrobref[1]);
-    scopedata.addDouble(xrobref[2]);
-
-    scopeport.setEnvelope(st);
-    scopeport.write();
-
-
-    // we need to add an offset and possibly a scaling factor to x, to keep thehand in the reaching space of the arm without moving the torso so much
-
-
-    // we need to add an offset to off-centre the movement to avoid interference with the torso and the movement backward
+    if(pending > 0 && backlog == BACKLOG_LATEST) {
+        skipped++;
+        return;
+    }
 
-    // we keep the orientation of the left arm constant:
-    // we want the middle finger to point forward (end-effector x-axis)
-    // with the palm turned between down and right (end-effector y-axis points leftward);
-    // to achieve that it is enough to rotate the root frame of pi around z-axis
+    //a newer bottle will publish the estimate including these events
+    bool publish = pending == 0 || backlog == BACKLOG_PROCESS;
+    if(!publish) collapsed++;
 
-    // left hand rotation
-    // od[0]=0.0; od[1]=-0.5; od[2]=1.0; od[3]=M_PI;
+    process(inputBottle, st, publish);
+}
 
-    // right hand rotation
-    od[0]=0.0; od[1]=-1.5; od[2]=1.0; od[3]=M_PI;
+/******************************************************************************/
+void vArmTraceController::process(vBottle &inputBottle,
+                                  const yarp::os::Stamp &st, bool publish)
+{
 
-    // go to the target :)
-    // (in streaming)
-    //arm->goToPose(xrobref,od);
-    xrobref[1] += 0.1;
-    arm->goToPosition(xrobref);
+    double t0 = yarp::os::Time::now();
+    if(st.isValid())
+        stats.record(vLatencyStats::TRANSPORT, t0 - st.getTime());
+
+    //every event in the bottle contributes to the (median) target position.
+    //the events are decoded in place rather than into a vQueue
+    double t = st.isValid() ? st.getTime() : yarp::os::Time::now();
+    unsigned int n = forEachAE(inputBottle, [this, t](const AE &v) {
+        estimator.add(v.x, v.y, t);
+    });
+    if(!n || !publish || !estimator.estimate(medx, medy)) return;
+    stats.record(vLatencyStats::DECODE, yarp::os::Time::now() - t0);
+
+    //turn u/v into xyz and give the target to one arm, once, so that both
+    //arms always agree on who has it
+    double t1 = yarp::os::Time::now();
+    px[0] = 303 - medx;
+    px[1] = 239 - medy;
+    if(!localprojector || !localprojector->project(px, targetdepth, target)) {
+        double t2 = yarp::os::Time::now();
+        gaze->get3DPoint(1, px, targetdepth, target);
+        stats.record(vLatencyStats::GET3D, yarp::os::Time::now() - t2);
+    }
+    int side = narms > 1 ? selector.select(target) : RIGHT_ARM;
+    stats.record(vLatencyStats::PROJECT, yarp::os::Time::now() - t1);
 
-    // some verbosity
-    // printStatus();
+    //publish the newest target. the command thread does the robot calls so
+    //that reading events never waits on the controllers
+    mailbox[side].post(target, st);
 
 //    if(gazedriver.isValid() && dogaze && demo == graspdemo && gazingActive) {
 //    //if(gazedriver.isValid() && demo == graspdemo && gazingActive) {
@@ -349,23 +945,92 @@ bool vArmTraceModule::configure(yarp::os::ResourceFinder &rf)
     //set the name of the module
     std::string moduleName = rf.check("name", yarp::os::Value("/vArmTracing")).asString();
 
+    printperiod = rf.check("printperiod",
+                           yarp::os::Value(PRINT_STATUS_PER)).asDouble();
+    tprint = yarp::os::Time::now();
+
     std::string rpcportname = moduleName + "/control";
     if(!rpcPort.open(rpcportname)) {
         std::cerr << "Could not open RPC port" << std::endl;
     }
     this->attach(rpcPort);
 
+    tracecontrol.setSimulation(rf.check("simulate"),
+                               rf.check("simlatency",
+                                        yarp::os::Value(SIM_LATENCY)).asDouble());
+    tracecontrol.setBimanual(rf.check("bimanual"));
+    tracecontrol.setControlPeriod(rf.check("period",
+                                  yarp::os::Value(CTRL_THREAD_PER)).asDouble());
+    tracecontrol.setScheduling(rf.check("rtpriority",
+                                        yarp::os::Value(0)).asInt(),
+                               rf.check("cpu", yarp::os::Value(-1)));
+    tracecontrol.setProjection(!rf.check("rpcprojection"),
+                               rf.check("eyeperiod",
+                                        yarp::os::Value(EYE_POSE_PER)).asDouble(),
+                               rf.check("depth",
+                                        yarp::os::Value(TARGET_DEPTH)).asDouble());
+    tracecontrol.setScopePeriod(rf.check("scopeperiod",
+                                   yarp::os::Value(SCOPE_PER)).asDouble());
+    tracecontrol.setPredictor(rf.check("predict"),
+                              rf.check("alpha",
+                                       yarp::os::Value(PRED_ALPHA)).asDouble(),
+                              rf.check("beta",
+                                       yarp::os::Value(PRED_BETA)).asDouble(),
+                              rf.check("lead",
+                                       yarp::os::Value(PRED_LEAD)).asDouble());
+    tracecontrol.setCommandFilter(rf.check("deadband",
+                                      yarp::os::Value(CMD_DEADBAND)).asDouble(),
+                                  rf.check("coalesce",
+                                      yarp::os::Value("latest")).asString() == "mean");
+    tracecontrol.setEstimatorWindow(rf.check("window",
+                                        yarp::os::Value(EST_WINDOW)).asDouble(),
+                                    rf.check("windowevents",
+                                        yarp::os::Value(EST_MAX_EVENTS)).asInt());
+
+    if(!tracecontrol.setBacklogPolicy(rf.check("backlog",
+                                      yarp::os::Value("latest")).asString(),
+                                      rf.check("maxpending",
+                                      yarp::os::Value(MAX_PENDING)).asInt()))
+        return false;
+
+    if(rf.check("record"))
+        tracecontrol.setRecording(rf.find("record").asString());
+
+    buildonly = rf.check("buildreachmap");
+    if(rf.check("reachmap") && !buildonly)
+        tracecontrol.setReachMap(rf.find("reachmap").asString());
+
+    tracecontrol.setReplaying(rf.check("replay"));
+
+    //query the solver over the workspace grid, save the maps and quit
+    if(buildonly) {
+        double res = rf.check("reachres",
+                              yarp::os::Value(REACH_RES)).asDouble();
+        return tracecontrol.buildReachMaps(moduleName,
+                                           rf.find("buildreachmap").asString(),
+                                           res);
+    }
+
     if(!tracecontrol.open(moduleName)) {
         std::cerr << "Could Not Open arm tracer controller" << std::endl;
         return false;
     }
 
+    //feed a recorded log instead of the input port
+    if(rf.check("replay")) {
+        if(!replayer.open(rf.find("replay").asString(), &tracecontrol,
+                          rf.check("speed", yarp::os::Value(1.0)).asDouble()))
+            return false;
+        replayer.start();
+    }
+
     return true ;
 }
 
 /******************************************************************************/
 bool vArmTraceModule::interruptModule()
 {
+    replayer.stop();
     tracecontrol.interrupt();
     yarp::os::RFModule::interruptModule();
     return true;
@@ -382,6 +1047,14 @@ bool vArmTraceModule::close()
 /******************************************************************************/
 bool vArmTraceModule::updateModule()
 {
+    if(buildonly) return false;
+
+    double t = yarp::os::Time::now();
+    if(printperiod > 0 && t - tprint >= printperiod) {
+        tracecontrol.printStatus();
+        tprint = t;
+    }
+
     return true;
 }
 
@@ -402,6 +1075,17 @@ bool vArmTraceModule::respond(const yarp::os::Bottle &command,
     } else if(command.get(0).asString() == "stop") {
         reply.addString("stopping");
         //this->vTrackToRobot.stopGazing();
+    } else if(command.get(0).asString() == "stats") {
+        //stats [reset]
+        tracecontrol.report(reply);
+        if(command.get(1).asString() == "reset")
+            tracecontrol.resetStats();
+    } else if(command.get(0).asString() == "set" ||
+              command.get(0).asString() == "get") {
+        //set period|trajtime|deadband|scopeperiod|predict|lead <value>
+        //set gains <alpha> <beta>
+        //get
+        tracecontrol.tune(command, reply);
     } else {
         return false;
     }
@@ -20,50 +20,259 @@
 
 #include <yarp/os/all.h>
 #include <iCub/eventdriven/all.h>
-#include <yarp/dev/GazeControl.h>
-#include <yarp/dev/CartesianControl.h>
-#include <yarp/dev/PolyDriver.h>
 #include <deque>
+#include <atomic>
+#include <thread>
+#include "devices.h"
+#include "projection.h"
+#include "estimator.h"
+#include "aedecode.h"
+#include "latency.h"
+#include "armstate.h"
+#include "scope.h"
+#include "predictor.h"
+#include "vbottlelog.h"
+#include "workspace.h"
+#include "reachmap.h"
+#include "lockfree.h"
 
+#define CTRL_THREAD_PER     0.02    // [s]
+#define CMD_DEADBAND        0.005   // [m]
+#define ARM_Y_OFFSET        0.1     // [m]
 #define PRINT_STATUS_PER    1.0     // [s]
-#define MAX_TORSO_PITCH     30.0    // [deg]
+#define MAX_PENDING         64      // [bottles]
+
+/*//////////////////////////////////////////////////////////////////////////////
+  TARGET MAILBOX
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the targets (root frame points) published by the event callback for one
+//arm between two fetches are coalesced into one: either the latest (latest-value-wins) or their mean. the
+//latest target and the running sums of all targets are kept in one seqlock
+//slot, so post() must only be called from one thread and never waits, and
+//fetch() always sees the newest target. a target is dropped when a newer one
+//supersedes it before a fetch (never when averaging, as it is in the mean)
+class vTargetMailbox
+{
+private:
+
+    //x y z, stamp count, stamp time, sums of x y z, targets posted
+    vSeqlock<9> slot;
+    bool average;
+
+    //written by post() only
+    double sum[3];
+
+    //the sums at the last fetch, used by fetch() only
+    double fetchedsum[3];
+    double fetchedn;
+
+    std::atomic<unsigned int> posted;
+    std::atomic<unsigned int> fetched;
+    std::atomic<unsigned int> dropped;
+
+public:
+
+    vTargetMailbox();
+
+    void setAveraging(bool average);
+    void post(const yarp::sig::Vector &x, const yarp::os::Stamp &st);
+    bool fetch(yarp::sig::Vector &x, yarp::os::Stamp &st);
+    void counts(unsigned int &posted, unsigned int &fetched,
+                unsigned int &dropped) const;
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM COMMAND THREAD
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the command parameters that can be tuned while running
+struct vCommandParams {
+    double deadband;    // [m]
+    double trajtime;    // [s]
+    bool predict;
+    double alpha;
+    double beta;
+    double lead;        // [s]
+};
+
+//performs all of the (blocking) calls to the robot controllers at its own
+//rate, using the coalesced target in the mailbox (already projected and
+//assigned to this arm). targets closer than the deadband to the last command
+//are not sent. the thread can be given a
+//SCHED_FIFO priority and pinned to a cpu. parameter changes are applied
+//together between two cycles
+class vArmCommandThread : public yarp::os::RateThread
+{
+private:
+
+    int side;
+    int rtpriority;
+    int cpu;
+    vTargetMailbox *mailbox;
+    vLatencyStats *stats;
+    vArmStateReader *armstate;
+    vArmDevice *arm;
+    vScopePublisher *scope;
+    const vReachMap *reachmap;
+
+    yarp::sig::Vector xrobref; //this stores the gaze position in eye ref frame
+    yarp::sig::Vector od; // orientation in cartesian space of end-effector (orientation of the hand)
+    yarp::sig::Vector handpos;
+    yarp::sig::Vector handor;
+
+    //the parameters in use and those to apply on the next cycle
+    vCommandParams params;
+    vCommandParams pending;
+    yarp::os::Mutex pm;
+    std::atomic<bool> changed;
+
+    void applyParams();
+
+    //look-ahead to compensate the latency of the pipeline
+    vAlphaBetaPredictor predictor;
+
+    //command suppression
+    yarp::sig::Vector lastcmd;
+    bool commanded;
+    std::atomic<unsigned int> sent;
+    std::atomic<unsigned int> suppressed;
+    std::atomic<unsigned int> clamped;
+
+public:
+
+    vArmCommandThread();
+
+    void setSide(int side);
+    void setScheduling(int rtpriority, int cpu);
+    void setPredictor(bool enable, double alpha, double beta, double lead);
+    void setDeadband(double deadband);
+    void setTrajTime(double trajtime);
+    vCommandParams getParams();
+    void setReachMap(const vReachMap *reachmap);
+    unsigned int clampedTargets() const { return clamped; }
+    void counts(unsigned int &sent, unsigned int &suppressed) const;
+    void attach(vTargetMailbox *mailbox,
+                vLatencyStats *stats,
+                vArmStateReader *armstate,
+                vArmDevice *arm,
+                vScopePublisher *scope);
+    bool threadInit();
+    void run();
+
+};
 
 /*//////////////////////////////////////////////////////////////////////////////
   VBOTTLE READER/PROCESSOR
   ////////////////////////////////////////////////////////////////////////////*/
 
+//what to do with a bottle when newer ones are already waiting in the port:
+//process it anyway, skip it, or only add its events to the estimator. under
+//any policy a bottle with more than maxpending newer ones waiting is dropped
+//unread, so that the strict port's queue cannot grow without bound
+enum backlogpolicy { BACKLOG_PROCESS, BACKLOG_LATEST, BACKLOG_COLLAPSE };
+
 class vArmTraceController : public yarp::os::BufferedPort<ev::vBottle>
 {
 private:
 
+    //robust target position over all recent events
+    vTargetEstimator estimator;
     double medx;
     double medy;
-    yarp::sig::Vector xrobref; //this stores the gaze position in eye ref frame
-    yarp::sig::Vector px; //the pixel position to make a gaze
 
-    yarp::dev::PolyDriver gazedriver;
-    yarp::dev::IGazeControl *gazecontrol;
+    //the robot (or simulated) controllers. the right arm is always used and
+    //the left arm as well in bimanual mode
+    vGazeDevice *gaze;
+    vArmDevice *arm[N_ARMS];
+    bool simulate;
+    double simlatency;
+    int narms;
+    vArmSelector selector;
 
-    yarp::dev::PolyDriver         client;
-    yarp::dev::ICartesianControl *arm;
+    vScopePublisher scope[N_ARMS];
+    double scopeperiod;
 
-    yarp::sig::Vector xd; // position in cartesian space
-    yarp::sig::Vector od; // orientation in cartesian space of end-effector (orientation of the hand)
+    //the newest target and the thread that acts on it, for each arm
+    vTargetMailbox mailbox[N_ARMS];
+    vArmCommandThread commandthread[N_ARMS];
+    double period;
+
+    //bottles from the replayer are the only input (the port is not opened)
+    bool replaying;
+
+    //input queue (the port is strict so YARP never drops bottles itself)
+    int backlog;
+    int maxpending;
+    std::atomic<unsigned int> received;
+    std::atomic<unsigned int> skipped;
+    std::atomic<unsigned int> collapsed;
+    std::atomic<unsigned int> overflowed;
+    std::atomic<int> depth;
+    std::atomic<int> maxdepth;
+
+    //local pixel to 3D projection (otherwise get3DPoint is used). each
+    //target is projected and assigned to an arm once, here
+    vEyeProjector projector;
+    vEyeProjector *localprojector;
+    bool localprojection;
+    double eyeperiod;
+    double targetdepth;
+    yarp::sig::Vector px;
+    yarp::sig::Vector target;
+
+    //timing of each stage of the pipeline
+    vLatencyStats stats;
 
-    int startup_context_id;
+    //streamed hand pose (otherwise getPose is used)
+    vArmStateReader armstate[N_ARMS];
 
-    yarp::os::BufferedPort<yarp::os::Bottle> scopeport;
+    //targets are clamped to the reachable workspace if a map is given
+    vReachMap reachmap[N_ARMS];
+    std::string reachprefix;
+
+    //optional log of the received bottles
+    vBottleRecorder recorder;
+    std::string recordfile;
 
 public:
 
     vArmTraceController();
+    ~vArmTraceController();
 
+    void setSimulation(bool simulate, double latency);
+    void setBimanual(bool bimanual);
+    void setControlPeriod(double period);
+    void setScheduling(int rtpriority, const yarp::os::Value &cpus);
+    void setReplaying(bool replaying);
+    bool setBacklogPolicy(const std::string &policy, int maxpending);
+    void setProjection(bool local, double eyeperiod, double depth);
+    void setEstimatorWindow(double window, unsigned int capacity);
+    void setScopePeriod(double period);
+    void setPredictor(bool enable, double alpha, double beta, double lead);
+    void setCommandFilter(double deadband, bool average);
+    void setRecording(const std::string &filename);
+    void setReachMap(const std::string &prefix);
+    bool openDevices(const std::string &name);
+    bool buildReachMaps(const std::string &name, const std::string &prefix,
+                        double res);
     bool open(const std::string &name);
     void onRead(ev::vBottle &bot);
+
+    //applies the backlog policy to a bottle with pending newer ones waiting
+    void input(ev::vBottle &bot, const yarp::os::Stamp &st, int pending);
+    void process(ev::vBottle &bot, const yarp::os::Stamp &st,
+                 bool publish = true);
     void interrupt();
     void close();
-    //void printStatus();
-    void limitTorsoPitch();
+    void printStatus();
+    void report(yarp::os::Bottle &b);
+    void resetStats();
+
+    //runtime tuning: "set <param> <value>..." and "get"
+    bool tune(const yarp::os::Bottle &command, yarp::os::Bottle &reply);
+    void parameters(yarp::os::Bottle &b);
 
 };
 
@@ -81,6 +290,16 @@ private:
     //the remote procedure port
     yarp::os::RpcServer     rpcPort;
 
+    //offline input from a recorded log
+    vBottleReplayer         replayer;
+
+    //period of the latency printout
+    double printperiod;
+    double tprint;
+
+    //the module only builds the reachability maps and quits
+    bool buildonly;
+
 public:
 
     //the virtual functions that need to be overloaded
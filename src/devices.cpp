@@ -0,0 +1,378 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "devices.h"
+#include <cmath>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  CARTESIAN ARM
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vCartesianArm::vCartesianArm()
+{
+    arm = 0;
+    startup_context_id = 0;
+}
+
+bool vCartesianArm::open(const std::string &local, const std::string &remote)
+{
+    yarp::os::Property options;
+    options.put("device","cartesiancontrollerclient");
+    options.put("remote", remote);
+    options.put("local", local);
+
+    // let's give the controller some time to warm up: the client is only
+    // opened once the server is up, but this might still fail if the
+    // controller is not connected to solver yet
+    double t0 = yarp::os::Time::now(), tready;
+    if(!retryWithBackoff(remote + "/rpc:i",
+                         [&]() { return client.open(options); }, tready))
+    {
+        yError()<<"Unable to open the Cartesian Controller";
+        return false;
+    }
+    double t1 = yarp::os::Time::now();
+
+    // open the view
+    client.view(arm);
+
+    // latch the controller context in order to preserve
+    // it after closing the module
+    // the context contains the dofs status, the tracking mode,
+    // the resting positions, the limits and so on.
+    arm->storeContext(&startup_context_id);
+
+    // set trajectory time
+    arm->setTrajTime(TRAJ_TIME);
+
+    // get the torso dofs
+    yarp::sig::Vector newDof, curDof;
+    arm->getDOF(curDof);
+    newDof=curDof;
+
+    // enable only the torso joints in TORSO_DOF (pitch, roll, yaw)
+    for(int i = 0; i < 3; i++)
+        newDof[i] = (TORSO_DOF >> i) & 1;
+
+    // send the request for dofs reconfiguration
+    arm->setDOF(newDof,curDof);
+
+    // impose some restriction on the torso pitch
+    limitTorsoPitch();
+
+    yInfo() << remote << "server up after" << tready << "s, connected after"
+            << t1 - t0 << "s, configured in" << yarp::os::Time::now() - t1 << "s";
+
+    return true;
+}
+
+void vCartesianArm::close()
+{
+    if(!arm) return;
+
+    // we require an immediate stop
+    // before closing the client for safety reason
+    arm->stopControl();
+
+    // it's a good rule to restore the controller
+    // context as it was before opening the module
+    arm->restoreContext(startup_context_id);
+
+    client.close();
+    arm = 0;
+}
+
+void vCartesianArm::limitTorsoPitch()
+{
+    int axis=0; // pitch joint
+    double min, max;
+
+    // sometimes it may be helpful to reduce
+    // the range of variability of the joints;
+    // for example here we don't want the torso
+    // to lean out more than 30 degrees forward
+
+    // we keep the lower limit
+    arm->getLimits(axis,&min,&max);
+    arm->setLimits(axis,min,MAX_TORSO_PITCH);
+}
+
+bool vCartesianArm::setTrajTime(double t)
+{
+    return arm->setTrajTime(t);
+}
+
+bool vCartesianArm::getPose(yarp::sig::Vector &x, yarp::sig::Vector &o)
+{
+    return arm->getPose(x, o);
+}
+
+bool vCartesianArm::goToPosition(const yarp::sig::Vector &x)
+{
+    return arm->goToPosition(x);
+}
+
+bool vCartesianArm::stopControl()
+{
+    return arm->stopControl();
+}
+
+bool vCartesianArm::askForPosition(const yarp::sig::Vector &xd,
+                                   yarp::sig::Vector &xdhat)
+{
+    yarp::sig::Vector odhat, qdhat;
+    return arm->askForPosition(xd, xdhat, odhat, qdhat);
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  IKIN GAZE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vIKinGaze::vIKinGaze()
+{
+    gazecontrol = 0;
+}
+
+bool vIKinGaze::open(const std::string &local, const std::string &remote)
+{
+    yarp::os::Property options;
+    options.put("device", "gazecontrollerclient");
+    options.put("local", local);
+    options.put("remote", remote);
+
+    double t0 = yarp::os::Time::now(), tready;
+    if(!retryWithBackoff(remote + "/rpc",
+                         [&]() { return gazedriver.open(options); }, tready)) {
+        yError() << "Gaze Driver not opened and will not be used";
+        return false;
+    }
+    gazedriver.view(gazecontrol);
+
+    yInfo() << remote << "server up after" << tready << "s, connected after"
+            << yarp::os::Time::now() - t0 << "s";
+
+    return true;
+}
+
+void vIKinGaze::close()
+{
+    gazedriver.close();
+    gazecontrol = 0;
+}
+
+bool vIKinGaze::get3DPoint(int camsel, const yarp::sig::Vector &px,
+                           double depth, yarp::sig::Vector &x)
+{
+    return gazecontrol->get3DPoint(camsel, px, depth, x);
+}
+
+bool vIKinGaze::getEyePose(int camsel, yarp::sig::Vector &x,
+                           yarp::sig::Vector &o)
+{
+    return camsel ? gazecontrol->getRightEyePose(x, o) :
+                    gazecontrol->getLeftEyePose(x, o);
+}
+
+bool vIKinGaze::getIntrinsics(int camsel, double &fx, double &fy,
+                              double &cx, double &cy)
+{
+    yarp::os::Bottle info;
+    if(!gazecontrol->getInfo(info)) return false;
+
+    //the 3x4 projection matrix is given row by row
+    std::string key = camsel ? "camera_intrinsics_right" :
+                               "camera_intrinsics_left";
+    yarp::os::Bottle *intrinsics = info.find(key).asList();
+    if(!intrinsics || intrinsics->size() < 12) return false;
+
+    fx = intrinsics->get(0).asDouble();
+    cx = intrinsics->get(2).asDouble();
+    fy = intrinsics->get(5).asDouble();
+    cy = intrinsics->get(6).asDouble();
+
+    return fx > 0 && fy > 0;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SIMULATED ARM
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vSimArm::vSimArm(double latency, int side)
+{
+    this->latency = latency;
+    trajtime = TRAJ_TIME;
+    workspace.setSide(side);
+
+    //hand in front of the robot, on its own side
+    x[0] = xd[0] = -0.3;
+    x[1] = xd[1] = side == LEFT_ARM ? -0.1 : 0.1;
+    x[2] = xd[2] = 0.1;
+    t = 0;
+}
+
+bool vSimArm::open(const std::string &local, const std::string &remote)
+{
+    t = yarp::os::Time::now();
+    yInfo() << "Simulating" << remote << "with" << latency * 1000.0
+            << "ms latency";
+    return true;
+}
+
+void vSimArm::close()
+{
+    stopControl();
+}
+
+void vSimArm::integrate(double now)
+{
+    //a first order system is at 95% after 3 time constants
+    double dt = now - t;
+    double a = 1.0 - std::exp(-3.0 * dt / trajtime);
+    for(int i = 0; i < 3; i++)
+        x[i] += a * (xd[i] - x[i]);
+    t = now;
+}
+
+bool vSimArm::setTrajTime(double t)
+{
+    yarp::os::Time::delay(latency);
+    m.lock();
+    integrate(yarp::os::Time::now());
+    trajtime = t > 0.01 ? t : 0.01;
+    m.unlock();
+    return true;
+}
+
+bool vSimArm::getPose(yarp::sig::Vector &x, yarp::sig::Vector &o)
+{
+    yarp::os::Time::delay(latency);
+    x.resize(3);
+    o.resize(4);
+
+    m.lock();
+    integrate(yarp::os::Time::now());
+    for(int i = 0; i < 3; i++)
+        x[i] = this->x[i];
+    m.unlock();
+
+    //the hand orientation is not simulated
+    o[0] = 0.0; o[1] = -1.5; o[2] = 1.0; o[3] = M_PI;
+
+    return true;
+}
+
+bool vSimArm::goToPosition(const yarp::sig::Vector &x)
+{
+    yarp::os::Time::delay(latency);
+    m.lock();
+    integrate(yarp::os::Time::now());
+    for(int i = 0; i < 3; i++)
+        xd[i] = x[i];
+    m.unlock();
+    return true;
+}
+
+bool vSimArm::askForPosition(const yarp::sig::Vector &xd,
+                             yarp::sig::Vector &xdhat)
+{
+    yarp::os::Time::delay(latency);
+    workspace.nearest(xd, xdhat);
+    return true;
+}
+
+bool vSimArm::stopControl()
+{
+    m.lock();
+    integrate(yarp::os::Time::now());
+    for(int i = 0; i < 3; i++)
+        xd[i] = x[i];
+    m.unlock();
+    return true;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SIMULATED GAZE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the eye is at SIM_EYE_POS with the optical axis along -x (forwards), the
+//image x along +y (right) and the image y along -z (down)
+static const double SIM_EYE_POS[3] = {-0.06, 0.034, 0.34};
+static const double SIM_FOCAL = 250.0;
+static const double SIM_CX = 152.0;
+static const double SIM_CY = 120.0;
+
+vSimGaze::vSimGaze(double latency)
+{
+    this->latency = latency;
+}
+
+bool vSimGaze::open(const std::string &local, const std::string &remote)
+{
+    yInfo() << "Simulating" << remote << "with" << latency * 1000.0
+            << "ms latency";
+    return true;
+}
+
+void vSimGaze::close()
+{
+}
+
+bool vSimGaze::get3DPoint(int camsel, const yarp::sig::Vector &px,
+                          double depth, yarp::sig::Vector &x)
+{
+    yarp::os::Time::delay(latency);
+
+    double xe = (px[0] - SIM_CX) * depth / SIM_FOCAL;
+    double ye = (px[1] - SIM_CY) * depth / SIM_FOCAL;
+
+    x.resize(3);
+    x[0] = SIM_EYE_POS[0] - depth;
+    x[1] = SIM_EYE_POS[1] + xe;
+    x[2] = SIM_EYE_POS[2] - ye;
+
+    return true;
+}
+
+bool vSimGaze::getEyePose(int camsel, yarp::sig::Vector &x,
+                          yarp::sig::Vector &o)
+{
+    yarp::os::Time::delay(latency);
+
+    x.resize(3);
+    for(int i = 0; i < 3; i++)
+        x[i] = SIM_EYE_POS[i];
+
+    //the rotation above in axis-angle form
+    o.resize(4);
+    o[0] = -1.0 / std::sqrt(3.0);
+    o[1] = -1.0 / std::sqrt(3.0);
+    o[2] = 1.0 / std::sqrt(3.0);
+    o[3] = 2.0 * M_PI / 3.0;
+
+    return true;
+}
+
+bool vSimGaze::getIntrinsics(int camsel, double &fx, double &fy, double &cx,
+                             double &cy)
+{
+    yarp::os::Time::delay(latency);
+
+    fx = fy = SIM_FOCAL;
+    cx = SIM_CX;
+    cy = SIM_CY;
+
+    return true;
+}
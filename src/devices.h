@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_DEVICES__
+#define __ICUB_ARMTRACE_DEVICES__
+
+#include <yarp/os/all.h>
+#include <yarp/dev/GazeControl.h>
+#include <yarp/dev/CartesianControl.h>
+#include <yarp/dev/PolyDriver.h>
+#include "workspace.h"
+
+#define MAX_TORSO_PITCH     30.0    // [deg]
+#define TORSO_DOF           0x0     // torso joints enabled (bits: pitch roll yaw)
+#define TRAJ_TIME           1.0     // [s]
+#define SIM_LATENCY         0.005   // [s]
+#define STARTUP_TIMEOUT     10.0    // [s]
+#define STARTUP_BACKOFF_MIN 0.02    // [s]
+#define STARTUP_BACKOFF_MAX 0.5     // [s]
+
+/*//////////////////////////////////////////////////////////////////////////////
+  DEVICE INTERFACES
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//waits (with exponential backoff) until the server port exists and open()
+//succeeds. returns false on timeout
+template <typename F>
+bool retryWithBackoff(const std::string &probeport, F open, double &tready)
+{
+    double t0 = yarp::os::Time::now();
+    double backoff = STARTUP_BACKOFF_MIN;
+    tready = -1;
+
+    while(yarp::os::Time::now() - t0 < STARTUP_TIMEOUT) {
+        if(yarp::os::Network::exists(probeport, true)) {
+            if(tready < 0) tready = yarp::os::Time::now() - t0;
+            if(open()) return true;
+        }
+        yarp::os::Time::delay(backoff);
+        backoff = backoff * 2 > STARTUP_BACKOFF_MAX ? STARTUP_BACKOFF_MAX :
+                                                      backoff * 2;
+    }
+
+    return false;
+}
+
+//the parts of the cartesian controller used by the arm tracer
+class vArmDevice
+{
+public:
+
+    virtual ~vArmDevice() {}
+
+    virtual bool open(const std::string &local, const std::string &remote) = 0;
+    virtual void close() = 0;
+
+    virtual bool setTrajTime(double t) = 0;
+    virtual bool getPose(yarp::sig::Vector &x, yarp::sig::Vector &o) = 0;
+    virtual bool goToPosition(const yarp::sig::Vector &x) = 0;
+    virtual bool stopControl() = 0;
+
+    //where the solver would put the hand if asked for xd (without moving)
+    virtual bool askForPosition(const yarp::sig::Vector &xd,
+                                yarp::sig::Vector &xdhat) = 0;
+
+};
+
+//the parts of the gaze controller used by the arm tracer
+class vGazeDevice
+{
+public:
+
+    virtual ~vGazeDevice() {}
+
+    virtual bool open(const std::string &local, const std::string &remote) = 0;
+    virtual void close() = 0;
+
+    virtual bool get3DPoint(int camsel, const yarp::sig::Vector &px,
+                            double depth, yarp::sig::Vector &x) = 0;
+    virtual bool getEyePose(int camsel, yarp::sig::Vector &x,
+                            yarp::sig::Vector &o) = 0;
+    virtual bool getIntrinsics(int camsel, double &fx, double &fy,
+                               double &cx, double &cy) = 0;
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ROBOT DEVICES
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//cartesiancontrollerclient. the controller context is stored on open and
+//restored on close
+class vCartesianArm : public vArmDevice
+{
+private:
+
+    yarp::dev::PolyDriver         client;
+    yarp::dev::ICartesianControl *arm;
+    int startup_context_id;
+
+    void limitTorsoPitch();
+
+public:
+
+    vCartesianArm();
+
+    bool open(const std::string &local, const std::string &remote);
+    void close();
+
+    bool setTrajTime(double t);
+    bool getPose(yarp::sig::Vector &x, yarp::sig::Vector &o);
+    bool goToPosition(const yarp::sig::Vector &x);
+    bool stopControl();
+    bool askForPosition(const yarp::sig::Vector &xd, yarp::sig::Vector &xdhat);
+
+};
+
+//gazecontrollerclient
+class vIKinGaze : public vGazeDevice
+{
+private:
+
+    yarp::dev::PolyDriver gazedriver;
+    yarp::dev::IGazeControl *gazecontrol;
+
+public:
+
+    vIKinGaze();
+
+    bool open(const std::string &local, const std::string &remote);
+    void close();
+
+    bool get3DPoint(int camsel, const yarp::sig::Vector &px, double depth,
+                    yarp::sig::Vector &x);
+    bool getEyePose(int camsel, yarp::sig::Vector &x, yarp::sig::Vector &o);
+    bool getIntrinsics(int camsel, double &fx, double &fy, double &cx,
+                       double &cy);
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SIMULATED DEVICES
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//in-process stand-in for the cartesian controller. every call waits for the
+//configured latency and the hand approaches the commanded position as a first
+//order system that settles within the trajectory time. the hand can reach
+//anywhere within the sphere of its vArmWorkspace
+class vSimArm : public vArmDevice
+{
+private:
+
+    vArmWorkspace workspace;
+    yarp::os::Mutex m;
+    double latency;
+    double trajtime;
+    double x[3];
+    double xd[3];
+    double t;
+
+    void integrate(double now);
+
+public:
+
+    vSimArm(double latency, int side = RIGHT_ARM);
+
+    bool open(const std::string &local, const std::string &remote);
+    void close();
+
+    bool setTrajTime(double t);
+    bool getPose(yarp::sig::Vector &x, yarp::sig::Vector &o);
+    bool goToPosition(const yarp::sig::Vector &x);
+    bool stopControl();
+    bool askForPosition(const yarp::sig::Vector &xd, yarp::sig::Vector &xdhat);
+
+};
+
+//in-process stand-in for the gaze controller with a fixed eye looking
+//straight ahead. every call waits for the configured latency
+class vSimGaze : public vGazeDevice
+{
+private:
+
+    double latency;
+
+public:
+
+    vSimGaze(double latency);
+
+    bool open(const std::string &local, const std::string &remote);
+    void close();
+
+    bool get3DPoint(int camsel, const yarp::sig::Vector &px, double depth,
+                    yarp::sig::Vector &x);
+    bool getEyePose(int camsel, yarp::sig::Vector &x, yarp::sig::Vector &o);
+    bool getIntrinsics(int camsel, double &fx, double &fy, double &cx,
+                       double &cy);
+
+};
+
+#endif
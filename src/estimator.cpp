@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "estimator.h"
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SLIDING MEDIAN
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vSlidingMedian::vSlidingMedian(int n)
+{
+    hist.resize(n, 0);
+    count = 0;
+    below = 0;
+    m = 0;
+}
+
+void vSlidingMedian::settle()
+{
+    if(!count) {
+        below = 0;
+        m = 0;
+        return;
+    }
+
+    //the (lower) median is the k-th smallest value
+    unsigned int k = (count - 1) / 2;
+    while(k < below) {
+        m--;
+        below -= hist[m];
+    }
+    while(k >= below + hist[m]) {
+        below += hist[m];
+        m++;
+    }
+}
+
+void vSlidingMedian::add(int v)
+{
+    hist[v]++;
+    count++;
+    if(v < m) below++;
+    settle();
+}
+
+void vSlidingMedian::remove(int v)
+{
+    hist[v]--;
+    count--;
+    if(v < m) below--;
+    settle();
+}
+
+void vSlidingMedian::clear()
+{
+    hist.assign(hist.size(), 0);
+    count = 0;
+    below = 0;
+    m = 0;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  TARGET ESTIMATOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vTargetEstimator::vTargetEstimator() : mx(SENSOR_WIDTH), my(SENSOR_HEIGHT)
+{
+    head = 0;
+    n = 0;
+    window = EST_WINDOW;
+    ring.resize(EST_MAX_EVENTS);
+}
+
+void vTargetEstimator::configure(double window, unsigned int capacity)
+{
+    this->window = window;
+    ring.resize(capacity > 0 ? capacity : 1);
+    clear();
+}
+
+void vTargetEstimator::evictOldest()
+{
+    entry &e = ring[(head + ring.size() - n) % ring.size()];
+    mx.remove(e.x);
+    my.remove(e.y);
+    n--;
+}
+
+void vTargetEstimator::add(int x, int y, double t)
+{
+    if(x < 0) x = 0;
+    if(x >= SENSOR_WIDTH) x = SENSOR_WIDTH - 1;
+    if(y < 0) y = 0;
+    if(y >= SENSOR_HEIGHT) y = SENSOR_HEIGHT - 1;
+
+    //remove events that have left the window (or would be overwritten)
+    while(n && ring[(head + ring.size() - n) % ring.size()].t < t - window)
+        evictOldest();
+    if(n == ring.size())
+        evictOldest();
+
+    entry &e = ring[head];
+    e.x = x;
+    e.y = y;
+    e.t = t;
+    head = (head + 1) % ring.size();
+    n++;
+
+    mx.add(x);
+    my.add(y);
+}
+
+bool vTargetEstimator::estimate(double &x, double &y) const
+{
+    if(!n) return false;
+    x = mx.median();
+    y = my.median();
+    return true;
+}
+
+void vTargetEstimator::clear()
+{
+    head = 0;
+    n = 0;
+    mx.clear();
+    my.clear();
+}
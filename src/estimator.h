@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_ESTIMATOR__
+#define __ICUB_ARMTRACE_ESTIMATOR__
+
+#include <vector>
+
+#define SENSOR_WIDTH        304
+#define SENSOR_HEIGHT       240
+#define EST_WINDOW          0.05    // [s]
+#define EST_MAX_EVENTS      1024
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SLIDING MEDIAN
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//median of a multiset of integers in [0, n) kept as a histogram. the median
+//bin is moved incrementally on each add/remove so that it only travels as far
+//as the data does
+class vSlidingMedian
+{
+private:
+
+    std::vector<unsigned int> hist;
+    unsigned int count;
+    unsigned int below; //number of values less than m
+    int m;              //the median bin
+
+    void settle();
+
+public:
+
+    vSlidingMedian(int n);
+
+    void add(int v);
+    void remove(int v);
+    void clear();
+    int median() const { return m; }
+    unsigned int size() const { return count; }
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  TARGET ESTIMATOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//median target position over all events received within a sliding time
+//window. all storage is allocated on configuration
+class vTargetEstimator
+{
+private:
+
+    struct entry {
+        int x;
+        int y;
+        double t;
+    };
+
+    std::vector<entry> ring;
+    unsigned int head;
+    unsigned int n;
+    double window;
+
+    vSlidingMedian mx;
+    vSlidingMedian my;
+
+    void evictOldest();
+
+public:
+
+    vTargetEstimator();
+
+    void configure(double window, unsigned int capacity);
+    void add(int x, int y, double t);
+    bool estimate(double &x, double &y) const;
+    void clear();
+
+};
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "latency.h"
+#include <cstdio>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  LATENCY HISTOGRAM
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vLatencyHistogram::vLatencyHistogram()
+{
+    reset();
+}
+
+int vLatencyHistogram::binIndex(uint64_t us)
+{
+    if(us < SUB_BINS) return (int)us;
+    if(us >= ((uint64_t)1 << (MAX_EXP + 1))) return N_BINS - 1;
+
+    int e = 63 - __builtin_clzll(us);
+    return (e - SUB_BITS + 1) * SUB_BINS + (int)((us >> (e - SUB_BITS)) & (SUB_BINS - 1));
+}
+
+uint64_t vLatencyHistogram::binLower(int i)
+{
+    if(i < SUB_BINS) return i;
+
+    int e = i / SUB_BINS + SUB_BITS - 1;
+    return (uint64_t)(SUB_BINS + i % SUB_BINS) << (e - SUB_BITS);
+}
+
+void vLatencyHistogram::record(double seconds)
+{
+    if(seconds < 0) seconds = 0;
+    uint64_t us = (uint64_t)(seconds * 1e6 + 0.5);
+
+    bins[binIndex(us)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(us, std::memory_order_relaxed);
+
+    uint64_t m = maximum.load(std::memory_order_relaxed);
+    while(us > m && !maximum.compare_exchange_weak(m, us,
+                                                   std::memory_order_relaxed))
+        ;
+}
+
+void vLatencyHistogram::reset()
+{
+    for(int i = 0; i < N_BINS; i++)
+        bins[i].store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    total.store(0, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
+}
+
+uint64_t vLatencyHistogram::samples() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+double vLatencyHistogram::percentile(double p) const
+{
+    //the bins can be updated while we read them, so the total is re-counted
+    uint64_t snapshot[N_BINS];
+    uint64_t n = 0;
+    for(int i = 0; i < N_BINS; i++) {
+        snapshot[i] = bins[i].load(std::memory_order_relaxed);
+        n += snapshot[i];
+    }
+    if(!n) return 0;
+
+    uint64_t rank = (uint64_t)(p * (n - 1) + 0.5);
+    uint64_t cumulative = 0;
+    for(int i = 0; i < N_BINS; i++) {
+        cumulative += snapshot[i];
+        if(cumulative > rank) {
+            //report the middle of the bin
+            return 0.5e-6 * (binLower(i) + binLower(i + 1));
+        }
+    }
+
+    return max();
+}
+
+double vLatencyHistogram::mean() const
+{
+    uint64_t n = samples();
+    if(!n) return 0;
+    return 1e-6 * total.load(std::memory_order_relaxed) / n;
+}
+
+double vLatencyHistogram::max() const
+{
+    return 1e-6 * maximum.load(std::memory_order_relaxed);
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  LATENCY STATISTICS
+  ////////////////////////////////////////////////////////////////////////////*/
+
+const char *vLatencyStats::name(int s)
+{
+    static const char *names[N_STAGES] = {
+        "transport", "decode", "project", "get3dpoint", "getpose", "goto",
+        "scope", "command"
+    };
+    return names[s];
+}
+
+void vLatencyStats::reset()
+{
+    for(int i = 0; i < N_STAGES; i++)
+        hist[i].reset();
+}
+
+void vLatencyStats::report(yarp::os::Bottle &b) const
+{
+    //(name count p50 p99 max) with times in [ms]
+    for(int i = 0; i < N_STAGES; i++) {
+        yarp::os::Bottle &s = b.addList();
+        s.addString(name(i));
+        s.addInt((int)hist[i].samples());
+        s.addDouble(hist[i].percentile(0.50) * 1000.0);
+        s.addDouble(hist[i].percentile(0.99) * 1000.0);
+        s.addDouble(hist[i].max() * 1000.0);
+    }
+}
+
+void vLatencyStats::print() const
+{
+    char line[128];
+    yInfo() << "stage       count      p50[ms]    p99[ms]    max[ms]";
+    for(int i = 0; i < N_STAGES; i++) {
+        std::snprintf(line, sizeof(line), "%-10s %6lu %10.3f %10.3f %10.3f",
+                      name(i), (unsigned long)hist[i].samples(),
+                      hist[i].percentile(0.50) * 1000.0,
+                      hist[i].percentile(0.99) * 1000.0,
+                      hist[i].max() * 1000.0);
+        yInfo() << line;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_LATENCY__
+#define __ICUB_ARMTRACE_LATENCY__
+
+#include <yarp/os/all.h>
+#include <atomic>
+#include <stdint.h>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  LATENCY HISTOGRAM
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//log-linear histogram of durations in microseconds (16 bins per power of two,
+//so the relative error of a percentile is below 1/16). recording is wait-free
+//and can be done concurrently from any thread
+class vLatencyHistogram
+{
+public:
+
+    static const int SUB_BITS = 4;
+    static const int SUB_BINS = 1 << SUB_BITS;
+    static const int MAX_EXP = 30;
+    static const int N_BINS = (MAX_EXP - SUB_BITS + 2) * SUB_BINS;
+
+private:
+
+    std::atomic<uint32_t> bins[N_BINS];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> total;
+    std::atomic<uint64_t> maximum;
+
+    static int binIndex(uint64_t us);
+    static uint64_t binLower(int i);
+
+public:
+
+    vLatencyHistogram();
+
+    void record(double seconds);
+    void reset();
+
+    uint64_t samples() const;
+    double percentile(double p) const; // [s]
+    double mean() const;               // [s]
+    double max() const;                // [s]
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  LATENCY STATISTICS
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//one histogram for each stage of the pipeline from the arrival of a tracker
+//bottle to the arm command
+class vLatencyStats
+{
+public:
+
+    enum stage {
+        TRANSPORT,  //envelope stamp to onRead
+        DECODE,     //bottle decoding and target estimation
+        PROJECT,    //pixel to 3D
+        GET3D,      //get3DPoint, when the local projection is unavailable
+        GETPOSE,    //current hand pose
+        GOTO,       //arm command
+        SCOPE,      //scope output
+        COMMAND,    //envelope stamp to arm command sent
+        N_STAGES
+    };
+
+private:
+
+    vLatencyHistogram hist[N_STAGES];
+
+public:
+
+    static const char *name(int s);
+
+    void record(stage s, double seconds) { hist[s].record(seconds); }
+    void reset();
+    void report(yarp::os::Bottle &b) const;
+    void print() const;
+
+};
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_LOCKFREE__
+#define __ICUB_ARMTRACE_LOCKFREE__
+
+#include <atomic>
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SEQLOCK
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//a slot of N doubles with a single writer and any number of readers. neither
+//side ever blocks: a reader that overlaps a write simply reads again
+template <int N>
+class vSeqlock
+{
+private:
+
+    std::atomic<unsigned int> seq;
+    std::atomic<double> data[N];
+
+public:
+
+    vSeqlock() : seq(0)
+    {
+        for(int i = 0; i < N; i++)
+            data[i].store(0.0, std::memory_order_relaxed);
+    }
+
+    void write(const double *d)
+    {
+        unsigned int s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for(int i = 0; i < N; i++)
+            data[i].store(d[i], std::memory_order_relaxed);
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    //returns false if nothing has been written yet
+    bool read(double *d) const
+    {
+        unsigned int s1, s2;
+        do {
+            s1 = seq.load(std::memory_order_acquire);
+            for(int i = 0; i < N; i++)
+                d[i] = data[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            s2 = seq.load(std::memory_order_relaxed);
+        } while(s1 != s2 || (s1 & 1));
+
+        return s1 != 0;
+    }
+
+};
+
+#endif
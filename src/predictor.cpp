@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "predictor.h"
+#include <cmath>
+
+vAlphaBetaPredictor::vAlphaBetaPredictor()
+{
+    alpha = PRED_ALPHA;
+    beta = PRED_BETA;
+    reset();
+}
+
+void vAlphaBetaPredictor::setGains(double alpha, double beta)
+{
+    this->alpha = alpha;
+    this->beta = beta;
+}
+
+void vAlphaBetaPredictor::reset()
+{
+    for(int i = 0; i < 3; i++) {
+        x[i] = 0;
+        v[i] = 0;
+    }
+    t = 0;
+    initialised = false;
+}
+
+void vAlphaBetaPredictor::update(const yarp::sig::Vector &z, double ts)
+{
+    double dt = ts - t;
+
+    if(!initialised || dt > PRED_RESET || dt < 0) {
+        for(int i = 0; i < 3; i++) {
+            x[i] = z[i];
+            v[i] = 0;
+        }
+        t = ts;
+        initialised = true;
+        return;
+    }
+
+    //observations with the same time stamp only correct the position
+    for(int i = 0; i < 3; i++) {
+        double xp = x[i] + v[i] * dt;
+        double r = z[i] - xp;
+        x[i] = xp + alpha * r;
+        if(dt > 0) v[i] += beta * r / dt;
+    }
+
+    //bound the speed so that a bad observation can't throw the arm
+    double speed = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if(speed > PRED_MAX_SPEED) {
+        for(int i = 0; i < 3; i++)
+            v[i] *= PRED_MAX_SPEED / speed;
+    }
+
+    t = ts;
+}
+
+void vAlphaBetaPredictor::predict(double lookahead,
+                                  yarp::sig::Vector &xp) const
+{
+    for(int i = 0; i < 3; i++)
+        xp[i] = x[i] + v[i] * lookahead;
+}
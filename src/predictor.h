@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_PREDICTOR__
+#define __ICUB_ARMTRACE_PREDICTOR__
+
+#include <yarp/sig/Vector.h>
+
+#define PRED_ALPHA          0.5
+#define PRED_BETA           0.1
+#define PRED_LEAD           0.0     // [s]
+#define PRED_RESET          0.5     // [s]
+#define PRED_MAX_SPEED      2.0     // [m/s]
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ALPHA-BETA PREDICTOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//estimates the target position and velocity from successive observations and
+//extrapolates the position into the future. the filter restarts if the
+//observations stop for longer than PRED_RESET
+class vAlphaBetaPredictor
+{
+private:
+
+    double alpha;
+    double beta;
+
+    double x[3];
+    double v[3];
+    double t;
+    bool initialised;
+
+public:
+
+    vAlphaBetaPredictor();
+
+    void setGains(double alpha, double beta);
+    void reset();
+
+    //z observed at time ts
+    void update(const yarp::sig::Vector &z, double ts);
+
+    //position lookahead seconds after the last observation
+    void predict(double lookahead, yarp::sig::Vector &xp) const;
+
+};
+
+#endif
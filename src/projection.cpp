@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "projection.h"
+#include <yarp/math/Math.h>
+
+vEyeProjector::vEyeProjector() : RateThread(EYE_POSE_PER * 1000)
+{
+    gaze = 0;
+    camsel = 1;
+    posevalid = false;
+    posetime = 0;
+    period = EYE_POSE_PER;
+    stale = false;
+    fx = fy = cx = cy = 0;
+    for(int r = 0; r < 3; r++)
+        for(int c = 0; c < 4; c++)
+            H[r][c] = 0;
+}
+
+bool vEyeProjector::initialise(vGazeDevice *gaze, int camsel, double period)
+{
+    this->gaze = gaze;
+    this->camsel = camsel;
+
+    if(!gaze->getIntrinsics(camsel, fx, fy, cx, cy)) {
+        yWarning() << "Camera intrinsics not available from the gaze controller";
+        return false;
+    }
+
+    if(!refreshPose()) {
+        yWarning() << "Could not read the eye pose from the gaze controller";
+        return false;
+    }
+
+    this->period = period;
+    setRate(period * 1000);
+
+    return true;
+}
+
+bool vEyeProjector::refreshPose()
+{
+    yarp::sig::Vector xeye, oeye;
+    if(!gaze->getEyePose(camsel, xeye, oeye)) return false;
+
+    //this does the transformation
+    yarp::sig::Matrix T = yarp::math::axis2dcm(oeye);
+
+    m.lock();
+    for(int r = 0; r < 3; r++) {
+        for(int c = 0; c < 3; c++)
+            H[r][c] = T(r, c);
+        H[r][3] = xeye[r];
+    }
+    posevalid = true;
+    posetime = yarp::os::Time::now();
+    m.unlock();
+
+    return true;
+}
+
+void vEyeProjector::run()
+{
+    //posetime is only written on this thread
+    if(refreshPose()) {
+        if(stale) yInfo() << "Eye pose refreshed: using local projection";
+        stale = false;
+    } else if(!stale && yarp::os::Time::now() - posetime >
+              EYE_POSE_STALE * period) {
+        yWarning() << "Eye pose not refreshed for" << EYE_POSE_STALE
+                   << "periods: using get3DPoint";
+        stale = true;
+    }
+}
+
+bool vEyeProjector::project(const yarp::sig::Vector &px, double depth,
+                            yarp::sig::Vector &x)
+{
+    //point in the eye reference frame
+    double xe = (px[0] - cx) * depth / fx;
+    double ye = (px[1] - cy) * depth / fy;
+    double ze = depth;
+
+    //point in the root reference frame
+    m.lock();
+    if(!posevalid ||
+            yarp::os::Time::now() - posetime > EYE_POSE_STALE * period) {
+        m.unlock();
+        return false;
+    }
+    for(int r = 0; r < 3; r++)
+        x[r] = H[r][0] * xe + H[r][1] * ye + H[r][2] * ze + H[r][3];
+    m.unlock();
+
+    return true;
+}
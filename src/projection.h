@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_PROJECTION__
+#define __ICUB_ARMTRACE_PROJECTION__
+
+#include <yarp/os/all.h>
+#include "devices.h"
+
+#define EYE_POSE_PER        0.05    // [s]
+#define EYE_POSE_STALE      4       // [periods]
+#define TARGET_DEPTH        0.3     // [m]
+
+/*//////////////////////////////////////////////////////////////////////////////
+  EYE PROJECTOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//back-projects a pixel to a 3D point in the robot root frame at a given depth
+//along the optical axis (equivalent to vGazeDevice::get3DPoint). the eye pose
+//is refreshed from the gaze controller at a low rate and the intrinsics are
+//read once, so a projection costs no remote calls. a pose not refreshed for
+//EYE_POSE_STALE periods is not used: project() fails and the caller falls
+//back to get3DPoint
+class vEyeProjector : public yarp::os::RateThread
+{
+private:
+
+    vGazeDevice *gaze;
+    int camsel;
+
+    //eye to root transformation (rotation | translation)
+    yarp::os::Mutex m;
+    double H[3][4];
+    bool posevalid;
+    double posetime;
+    double period;
+    bool stale;
+
+    //camera intrinsics
+    double fx, fy, cx, cy;
+
+    bool refreshPose();
+
+public:
+
+    vEyeProjector();
+
+    bool initialise(vGazeDevice *gaze, int camsel, double period);
+    bool project(const yarp::sig::Vector &px, double depth,
+                 yarp::sig::Vector &x);
+    void run();
+
+};
+
+#endif
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "reachmap.h"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char REACH_MAGIC[8] = {'V', 'R', 'E', 'A', 'C', 'H', '0', '1'};
+
+vReachMap::vReachMap()
+{
+    data = 0;
+    length = 0;
+    cells = 0;
+    std::memset(&header, 0, sizeof(header));
+}
+
+vReachMap::~vReachMap()
+{
+    close();
+}
+
+bool vReachMap::build(vArmDevice *arm, const std::string &part, double res,
+                      const std::string &filename)
+{
+    vReachHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, REACH_MAGIC, sizeof(REACH_MAGIC));
+    std::strncpy(h.part, part.c_str(), sizeof(h.part) - 1);
+    h.torsodof = TORSO_DOF;
+    h.maxtorsopitch = MAX_TORSO_PITCH;
+    h.min[0] = REACH_MIN_X;
+    h.min[1] = REACH_MIN_Y;
+    h.min[2] = REACH_MIN_Z;
+    h.res = res;
+    h.n[0] = std::ceil((REACH_MAX_X - REACH_MIN_X) / res);
+    h.n[1] = std::ceil((REACH_MAX_Y - REACH_MIN_Y) / res);
+    h.n[2] = std::ceil((REACH_MAX_Z - REACH_MIN_Z) / res);
+
+    //ask the solver where it would put the hand for every cell centre
+    yarp::sig::Vector xd(3), xdhat;
+    size_t plane = (size_t)h.n[0] * h.n[1];
+    std::vector<vReachCell> cells(plane * h.n[2]);
+    std::vector<size_t> known;
+    unsigned int reachable = 0, failed = 0;
+    double t0 = yarp::os::Time::now();
+
+    for(int k = 0; k < h.n[2]; k++) {
+        for(int j = 0; j < h.n[1]; j++) {
+            for(int i = 0; i < h.n[0]; i++) {
+
+                xd[0] = h.min[0] + (i + 0.5) * res;
+                xd[1] = h.min[1] + (j + 0.5) * res;
+                xd[2] = h.min[2] + (k + 0.5) * res;
+
+                size_t ci = k * plane + j * h.n[0] + i;
+                vReachCell &c = cells[ci];
+                if(!arm->askForPosition(xd, xdhat) || xdhat.size() < 3) {
+                    //unreachable: filled in from the nearest answered cell
+                    c.err = INFINITY;
+                    failed++;
+                    continue;
+                }
+
+                double e2 = 0;
+                for(int d = 0; d < 3; d++) {
+                    c.p[d] = xdhat[d];
+                    e2 += (xdhat[d] - xd[d]) * (xdhat[d] - xd[d]);
+                }
+                c.err = std::sqrt(e2);
+                if(c.err <= 0.5 * res) reachable++;
+                known.push_back(ci);
+            }
+        }
+
+        yInfo() << part << "reachability map:" << k + 1 << "/" << h.n[2]
+                << "planes";
+    }
+
+    //the failed cells take the point of the nearest (in steps between
+    //neighbouring cells) answered one, or NaN if the solver never answered
+    std::vector<bool> filled(cells.size(), false);
+    for(size_t q = 0; q < known.size(); q++)
+        filled[known[q]] = true;
+    for(size_t q = 0; q < known.size(); q++) {
+        size_t ci = known[q];
+        int n[3] = {(int)(ci % h.n[0]), (int)(ci / h.n[0] % h.n[1]),
+                    (int)(ci / plane)};
+        for(int d = 0; d < 3; d++) {
+            for(int s = -1; s <= 1; s += 2) {
+                int m[3] = {n[0], n[1], n[2]};
+                m[d] += s;
+                if(m[d] < 0 || m[d] >= h.n[d]) continue;
+                size_t cj = m[2] * plane + m[1] * h.n[0] + m[0];
+                if(filled[cj]) continue;
+                filled[cj] = true;
+                std::memcpy(cells[cj].p, cells[ci].p, sizeof(cells[ci].p));
+                known.push_back(cj);
+            }
+        }
+    }
+    for(size_t ci = 0; ci < cells.size(); ci++)
+        if(!filled[ci])
+            cells[ci].p[0] = cells[ci].p[1] = cells[ci].p[2] = NAN;
+
+    //a short write (e.g. a full disk) must not leave a truncated map: the
+    //map is written beside the file and only replaces it once complete
+    std::string tmpname = filename + ".tmp";
+    FILE *f = std::fopen(tmpname.c_str(), "wb");
+    if(!f) {
+        yError() << "Could not open" << tmpname << "for writing";
+        return false;
+    }
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1;
+    ok = ok && std::fwrite(cells.data(), sizeof(vReachCell), cells.size(),
+                           f) == cells.size();
+    ok = (std::fclose(f) == 0) && ok;
+    if(!ok || std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+        yError() << "Could not write" << filename;
+        std::remove(tmpname.c_str());
+        return false;
+    }
+
+    yInfo() << "Built" << filename << "(" << h.n[0] << "x" << h.n[1] << "x"
+            << h.n[2] << "cells," << reachable << "reachable," << failed
+            << "failed ) in" << yarp::os::Time::now() - t0 << "s";
+
+    return true;
+}
+
+bool vReachMap::open(const std::string &filename, const std::string &part)
+{
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0) {
+        yError() << "Could not open reachability map" << filename;
+        return false;
+    }
+
+    struct stat sb;
+    if(fstat(fd, &sb) < 0 || sb.st_size < (off_t)sizeof(vReachHeader)) {
+        yError() << filename << "is not a reachability map";
+        ::close(fd);
+        return false;
+    }
+
+    void *p = mmap(0, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(p == MAP_FAILED) {
+        yError() << "Could not map" << filename;
+        return false;
+    }
+    data = (const char *)p;
+    length = sb.st_size;
+
+    std::memcpy(&header, data, sizeof(header));
+    size_t ncells = (size_t)header.n[0] * header.n[1] * header.n[2];
+    if(std::memcmp(header.magic, REACH_MAGIC, sizeof(REACH_MAGIC)) ||
+            header.n[0] <= 0 || header.n[1] <= 0 || header.n[2] <= 0 ||
+            header.res <= 0 ||
+            length != sizeof(header) + ncells * sizeof(vReachCell)) {
+        yError() << filename << "is not a reachability map";
+        close();
+        return false;
+    }
+
+    //a map of another arm or torso configuration would clamp wrongly
+    if(part != std::string(header.part, strnlen(header.part,
+                                                sizeof(header.part))) ||
+            header.torsodof != TORSO_DOF ||
+            header.maxtorsopitch != (float)MAX_TORSO_PITCH) {
+        yError() << filename << "was built for another arm configuration";
+        close();
+        return false;
+    }
+
+    cells = (const vReachCell *)(data + sizeof(header));
+
+    //lookups jump around the grid
+    madvise(p, length, MADV_RANDOM);
+
+    yInfo() << "Loaded" << part << "reachability map" << filename;
+
+    return true;
+}
+
+void vReachMap::close()
+{
+    if(data) munmap((void *)data, length);
+    data = 0;
+    length = 0;
+    cells = 0;
+}
+
+bool vReachMap::clamp(yarp::sig::Vector &x) const
+{
+    if(!cells) return false;
+
+    //a failed projection has no cell
+    for(int d = 0; d < 3; d++)
+        if(!std::isfinite(x[d])) return false;
+
+    //targets outside the grid take the nearest edge cell (compared before the
+    //conversion, as a far target does not fit in an int)
+    int idx[3];
+    bool inside = true;
+    for(int d = 0; d < 3; d++) {
+        double i = std::floor((x[d] - header.min[d]) / header.res);
+        if(i < 0) {
+            idx[d] = 0;
+            inside = false;
+        } else if(i >= header.n[d]) {
+            idx[d] = header.n[d] - 1;
+            inside = false;
+        } else {
+            idx[d] = (int)i;
+        }
+    }
+
+    const vReachCell &c = cells[(idx[2] * header.n[1] + idx[1]) *
+                                header.n[0] + idx[0]];
+    if(inside && c.err <= 0.5 * header.res) return false;
+
+    //nothing is known to be reachable
+    if(std::isnan(c.p[0])) return false;
+
+    for(int d = 0; d < 3; d++)
+        x[d] = c.p[d];
+
+    return true;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_REACHMAP__
+#define __ICUB_ARMTRACE_REACHMAP__
+
+#include <yarp/os/all.h>
+#include <yarp/sig/Vector.h>
+#include <stdint.h>
+#include "devices.h"
+
+#define REACH_RES           0.02    // [m]
+#define REACH_MIN_X         -0.6    // [m]
+#define REACH_MAX_X         0.0     // [m]
+#define REACH_MIN_Y         -0.5    // [m]
+#define REACH_MAX_Y         0.5     // [m]
+#define REACH_MIN_Z         -0.2    // [m]
+#define REACH_MAX_Z         0.6     // [m]
+
+/* reachability map layout:
+ *   header : vReachHeader
+ *   cells  : vReachCell for each cell, x fastest then y then z
+ * a map is only valid for the arm and torso configuration it was built with.
+ */
+
+struct vReachHeader {
+    char magic[8];
+    char part[16];          //cartesian controller part
+    int32_t torsodof;       //TORSO_DOF
+    float maxtorsopitch;    //MAX_TORSO_PITCH [deg]
+    float min[3];           //corner of the first cell [m]
+    float res;              //cell size [m]
+    int32_t n[3];           //cells along x, y and z
+};
+
+struct vReachCell {
+    float p[3];             //nearest reachable point to the cell centre [m]
+    float err;              //distance from the cell centre to p [m], or
+                            //infinite if the solver gave no answer (p is
+                            //then the nearest answered cell's point)
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  REACHABILITY MAP
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//a 3D grid over the space in front of the robot storing, for each cell, the
+//point the cartesian solver actually reaches when asked for the cell centre.
+//the grid is built offline (one askForPosition per cell) and memory-mapped
+//at runtime so that a target is clamped with a single lookup
+class vReachMap
+{
+private:
+
+    const char *data;
+    size_t length;
+    vReachHeader header;
+    const vReachCell *cells;
+
+public:
+
+    vReachMap();
+    ~vReachMap();
+
+    static bool build(vArmDevice *arm, const std::string &part, double res,
+                      const std::string &filename);
+
+    bool open(const std::string &filename, const std::string &part);
+    void close();
+    bool isOpen() const { return data != 0; }
+
+    //moves x onto the nearest reachable point if it is not reachable (a cell
+    //the solver gave no answer for is not). returns true if x was changed,
+    //never for a non-finite x
+    bool clamp(yarp::sig::Vector &x) const;
+
+};
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "scope.h"
+
+vScopePublisher::vScopePublisher() : RateThread(SCOPE_PER * 1000)
+{
+    posted = 0;
+    lastcount = -1;
+    written = 0;
+    dropped = 0;
+}
+
+bool vScopePublisher::open(const std::string &name, double period)
+{
+    if(!port.open(name)) {
+        yError() << "Could not open scope port";
+        return false;
+    }
+
+    setRate(period * 1000);
+    return start();
+}
+
+void vScopePublisher::close()
+{
+    if(isRunning()) stop();
+    port.close();
+}
+
+void vScopePublisher::post(const yarp::sig::Vector &hand,
+                           const yarp::sig::Vector &target,
+                           const yarp::os::Stamp &st)
+{
+    double d[8];
+    d[0] = hand[0]; d[1] = hand[1]; d[2] = hand[2];
+    d[3] = target[0]; d[4] = target[1]; d[5] = target[2];
+    d[6] = ++posted;
+    d[7] = st.getTime();
+    slot.write(d);
+}
+
+void vScopePublisher::counts(unsigned int &written,
+                             unsigned int &dropped) const
+{
+    written = this->written;
+    dropped = this->dropped;
+}
+
+void vScopePublisher::run()
+{
+    double d[8];
+    if(!slot.read(d)) return;
+
+    //only new samples are written
+    if((int)d[6] == lastcount) return;
+    lastcount = (int)d[6];
+
+    //never wait on the consumer
+    if(port.isWriting()) {
+        dropped++;
+        return;
+    }
+
+    yarp::sig::Vector &scopedata = port.prepare();
+    scopedata.resize(6);
+    for(int i = 0; i < 6; i++)
+        scopedata[i] = d[i];
+
+    yarp::os::Stamp st(lastcount, d[7]);
+    port.setEnvelope(st);
+    port.write();
+    written++;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_SCOPE__
+#define __ICUB_ARMTRACE_SCOPE__
+
+#include <atomic>
+#include <yarp/os/all.h>
+#include "lockfree.h"
+
+#define SCOPE_PER           0.02    // [s]
+
+/*//////////////////////////////////////////////////////////////////////////////
+  SCOPE PUBLISHER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//decouples the scope output from the control loop. samples are posted into a
+//lock-free slot and written at a fixed rate as a Vector
+//[hand_x hand_y hand_z target_x target_y target_z]. if the previous write has
+//not completed (slow consumer) the sample is dropped
+class vScopePublisher : public yarp::os::RateThread
+{
+private:
+
+    yarp::os::BufferedPort<yarp::sig::Vector> port;
+
+    //hand (3), target (3), sample count and envelope time
+    vSeqlock<8> slot;
+    unsigned int posted;
+    int lastcount;
+
+    std::atomic<unsigned int> written;
+    std::atomic<unsigned int> dropped;
+
+public:
+
+    vScopePublisher();
+
+    bool open(const std::string &name, double period);
+    void close();
+
+    void post(const yarp::sig::Vector &hand, const yarp::sig::Vector &target,
+              const yarp::os::Stamp &st);
+    void run();
+
+    //samples written to the port and dropped for a slow consumer
+    void counts(unsigned int &written, unsigned int &dropped) const;
+
+};
+
+#endif
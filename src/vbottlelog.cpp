@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "vbottlelog.h"
+#include "armtracing.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char LOG_MAGIC[8] = {'V', 'B', 'L', 'O', 'G', '0', '0', '1'};
+static const char IDX_MAGIC[8] = {'V', 'B', 'L', 'O', 'G', 'I', 'D', 'X'};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  RECORDER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vBottleRecorder::vBottleRecorder()
+{
+    f = 0;
+    offset = 0;
+}
+
+vBottleRecorder::~vBottleRecorder()
+{
+    close();
+}
+
+bool vBottleRecorder::open(const std::string &filename)
+{
+    f = std::fopen(filename.c_str(), "wb");
+    if(!f) {
+        yError() << "Could not open" << filename << "for recording";
+        return false;
+    }
+
+    if(std::fwrite(LOG_MAGIC, 1, sizeof(LOG_MAGIC), f) != sizeof(LOG_MAGIC)) {
+        yError() << "Could not write to" << filename;
+        std::fclose(f);
+        f = 0;
+        return false;
+    }
+    this->filename = filename;
+    offset = sizeof(LOG_MAGIC);
+    index.clear();
+    index.reserve(65536);
+
+    return true;
+}
+
+void vBottleRecorder::record(ev::vBottle &bot, const yarp::os::Stamp &st,
+                             double arrival)
+{
+    if(!f) return;
+
+    size_t size = 0;
+    const char *payload = bot.toBinary(&size);
+
+    vLogRecord r;
+    r.arrival = arrival;
+    r.stamptime = st.isValid() ? st.getTime() : arrival;
+    r.stampcount = st.isValid() ? st.getCount() : -1;
+    r.size = size;
+
+    //on a failed write (e.g. a full disk) recording stops and the log is cut
+    //back to the last whole record and left without an index, so the replayer
+    //finds the records by scanning
+    if(std::fwrite(&r, sizeof(r), 1, f) != 1 ||
+            std::fwrite(payload, 1, size, f) != size) {
+        yError() << "Could not write" << filename << ": recording stopped";
+        abandon();
+        return;
+    }
+
+    index.push_back(offset);
+    offset += sizeof(r) + size;
+}
+
+void vBottleRecorder::abandon()
+{
+    //closing flushes what is left of the buffer, so the cut comes after. a
+    //log shorter than the records already ends in a part record, which the
+    //scan leaves out
+    std::fclose(f);
+    f = 0;
+    struct stat sb;
+    if(!stat(filename.c_str(), &sb) && (uint64_t)sb.st_size > offset &&
+            ::truncate(filename.c_str(), offset))
+        yError() << "Could not cut" << filename << "back to its last whole record";
+}
+
+void vBottleRecorder::close()
+{
+    if(!f) return;
+
+    vLogTrailer t;
+    t.indexoffset = offset;
+    t.count = index.size();
+    std::memcpy(t.magic, IDX_MAGIC, sizeof(IDX_MAGIC));
+
+    bool ok = !index.size() ||
+            std::fwrite(index.data(), sizeof(uint64_t), index.size(), f) ==
+            index.size();
+    ok = ok && std::fwrite(&t, sizeof(t), 1, f) == 1 && std::fflush(f) == 0;
+
+    if(!ok) {
+        yError() << "Could not write the index of" << filename
+                 << ": the replay will scan for the records";
+        abandon();
+        return;
+    }
+
+    if(std::fclose(f))
+        yError() << "Could not close" << filename;
+    else
+        yInfo() << "Recorded" << index.size() << "bottles";
+    f = 0;
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  REPLAYER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vBottleReplayer::vBottleReplayer()
+{
+    controller = 0;
+    speed = 1.0;
+    data = 0;
+    length = 0;
+}
+
+vBottleReplayer::~vBottleReplayer()
+{
+    close();
+}
+
+bool vBottleReplayer::buildIndex()
+{
+    index.clear();
+
+    //use the stored index if the log was closed properly
+    if(length >= sizeof(LOG_MAGIC) + sizeof(vLogTrailer)) {
+        vLogTrailer t;
+        std::memcpy(&t, data + length - sizeof(t), sizeof(t));
+        if(!std::memcmp(t.magic, IDX_MAGIC, sizeof(IDX_MAGIC)) &&
+                t.indexoffset + t.count * sizeof(uint64_t) + sizeof(t) == length) {
+            index.resize(t.count);
+            if(t.count)
+                std::memcpy(index.data(), data + t.indexoffset,
+                            t.count * sizeof(uint64_t));
+            return true;
+        }
+    }
+
+    //otherwise walk the records
+    yWarning() << "Log has no index: scanning records";
+    uint64_t offset = sizeof(LOG_MAGIC);
+    while(offset + sizeof(vLogRecord) <= length) {
+        vLogRecord r;
+        std::memcpy(&r, data + offset, sizeof(r));
+        if(offset + sizeof(r) + r.size > length) break;
+        index.push_back(offset);
+        offset += sizeof(r) + r.size;
+    }
+
+    return true;
+}
+
+bool vBottleReplayer::open(const std::string &filename,
+                           vArmTraceController *controller, double speed)
+{
+    this->controller = controller;
+    this->speed = speed;
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0) {
+        yError() << "Could not open" << filename << "for replay";
+        return false;
+    }
+
+    struct stat sb;
+    if(fstat(fd, &sb) < 0 || sb.st_size < (off_t)sizeof(LOG_MAGIC)) {
+        yError() << filename << "is not a vBottle log";
+        ::close(fd);
+        return false;
+    }
+
+    void *p = mmap(0, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(p == MAP_FAILED) {
+        yError() << "Could not map" << filename;
+        return false;
+    }
+    data = (const char *)p;
+    length = sb.st_size;
+
+    if(std::memcmp(data, LOG_MAGIC, sizeof(LOG_MAGIC))) {
+        yError() << filename << "is not a vBottle log";
+        close();
+        return false;
+    }
+
+    //the log is read sequentially
+    madvise(p, length, MADV_SEQUENTIAL);
+
+    buildIndex();
+    yInfo() << "Replaying" << index.size() << "bottles from" << filename;
+
+    return true;
+}
+
+void vBottleReplayer::close()
+{
+    if(data) munmap((void *)data, length);
+    data = 0;
+    length = 0;
+}
+
+void vBottleReplayer::run()
+{
+    if(index.empty()) return;
+
+    ev::vBottle bot;
+    vLogRecord r;
+    std::memcpy(&r, data + index.front(), sizeof(r));
+    double rstart = r.arrival;
+    double tstart = yarp::os::Time::now();
+
+    //the last record known to be due. arrival times only grow, so it only
+    //moves forward and each record is looked at once
+    unsigned int due = 0;
+
+    unsigned int i;
+    for(i = 0; i < index.size() && !isStopping(); i++) {
+
+        std::memcpy(&r, data + index[i], sizeof(r));
+
+        //wait for the (scaled) recorded arrival time
+        if(speed > 0) {
+            double wait = tstart + (r.arrival - rstart) / speed -
+                    yarp::os::Time::now();
+            if(wait > 0) yarp::os::Time::delay(wait);
+        }
+
+        bot.fromBinary(data + index[i] + sizeof(r), r.size);
+
+        //the bottles that would have arrived by now are the backlog the
+        //port would hold, so the controller's backlog policy applies as it
+        //does live (none when replaying as fast as possible)
+        double now = yarp::os::Time::now();
+        int pending = 0;
+        if(speed > 0) {
+            if(due < i) due = i;
+            while(due + 1 < index.size()) {
+                vLogRecord next;
+                std::memcpy(&next, data + index[due + 1], sizeof(next));
+                if(tstart + (next.arrival - rstart) / speed > now) break;
+                due++;
+            }
+            pending = due - i;
+        }
+
+        yarp::os::Stamp st(r.stampcount, now - (r.arrival - r.stamptime));
+        controller->input(bot, st, pending);
+    }
+
+    double elapsed = yarp::os::Time::now() - tstart;
+    yInfo() << "Replayed" << i << "bottles in" << elapsed << "s ("
+            << (elapsed > 0 ? i / elapsed : 0) << "bottles/s )";
+    controller->printStatus();
+}
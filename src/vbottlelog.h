@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_VBOTTLELOG__
+#define __ICUB_ARMTRACE_VBOTTLELOG__
+
+#include <yarp/os/all.h>
+#include <iCub/eventdriven/all.h>
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+/* binary log layout:
+ *   header  : "VBLOG001"
+ *   records : vLogRecord followed by the Bottle::toBinary() payload
+ *   index   : uint64_t file offset of each record
+ *   trailer : vLogTrailer
+ * a log without a valid trailer (e.g. the recorder was killed) is re-indexed
+ * by scanning the records.
+ */
+
+struct vLogRecord {
+    double arrival;     //local time the bottle was read
+    double stamptime;   //envelope time
+    int32_t stampcount; //envelope count (-1 if no envelope)
+    uint32_t size;      //payload bytes
+};
+
+struct vLogTrailer {
+    uint64_t indexoffset;
+    uint64_t count;
+    char magic[8];
+};
+
+class vArmTraceController;
+
+/*//////////////////////////////////////////////////////////////////////////////
+  RECORDER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+class vBottleRecorder
+{
+private:
+
+    FILE *f;
+    uint64_t offset;
+    std::vector<uint64_t> index;
+    std::string filename;
+
+    //ends a failed recording at the last whole record, without an index
+    void abandon();
+
+public:
+
+    vBottleRecorder();
+    ~vBottleRecorder();
+
+    bool open(const std::string &filename);
+    bool isOpen() const { return f != 0; }
+    void record(ev::vBottle &bot, const yarp::os::Stamp &st, double arrival);
+    void close();
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  REPLAYER
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//memory-maps a log and feeds the bottles to the controller at the recorded
+//rate multiplied by speed (speed <= 0 replays as fast as possible). envelope
+//times are shifted so that each bottle keeps its recorded transport delay, and
+//the bottles already due count as the port backlog for the backlog policy
+class vBottleReplayer : public yarp::os::Thread
+{
+private:
+
+    vArmTraceController *controller;
+    double speed;
+
+    const char *data;
+    size_t length;
+    std::vector<uint64_t> index;
+
+    bool buildIndex();
+
+public:
+
+    vBottleReplayer();
+    ~vBottleReplayer();
+
+    bool open(const std::string &filename, vArmTraceController *controller,
+              double speed);
+    void close();
+    unsigned int size() const { return index.size(); }
+    void run();
+
+};
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#include "workspace.h"
+#include <cmath>
+
+const char *armPart(int side)
+{
+    return side == LEFT_ARM ? "left_arm" : "right_arm";
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM WORKSPACE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vArmWorkspace::vArmWorkspace()
+{
+    reach = ARM_REACH;
+    setSide(RIGHT_ARM);
+}
+
+void vArmWorkspace::setSide(int side)
+{
+    //the root frame y axis points to the right of the robot
+    centre[0] = 0.0;
+    centre[1] = side == LEFT_ARM ? -SHOULDER_Y : SHOULDER_Y;
+    centre[2] = SHOULDER_Z;
+}
+
+double vArmWorkspace::distance(const yarp::sig::Vector &x) const
+{
+    double dx = x[0] - centre[0];
+    double dy = x[1] - centre[1];
+    double dz = x[2] - centre[2];
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+bool vArmWorkspace::contains(const yarp::sig::Vector &x) const
+{
+    return distance(x) <= reach;
+}
+
+void vArmWorkspace::nearest(const yarp::sig::Vector &x,
+                            yarp::sig::Vector &xn) const
+{
+    double d = distance(x);
+    double s = d > reach ? reach / d : 1.0;
+
+    xn.resize(3);
+    for(int i = 0; i < 3; i++)
+        xn[i] = centre[i] + s * (x[i] - centre[i]);
+}
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM SELECTOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+vArmSelector::vArmSelector()
+{
+    for(int i = 0; i < N_ARMS; i++) {
+        workspace[i].setSide(i);
+        enabled[i] = i == RIGHT_ARM;
+    }
+}
+
+void vArmSelector::enable(int side, bool enable)
+{
+    enabled[side] = enable;
+}
+
+int vArmSelector::select(const yarp::sig::Vector &x) const
+{
+    int best = -1;
+    bool bestcovers = false;
+    double bestd = 0;
+
+    for(int i = 0; i < N_ARMS; i++) {
+        if(!enabled[i]) continue;
+        double d = workspace[i].distance(x);
+        bool covers = workspace[i].contains(x);
+
+        //an arm that covers the target always beats one that doesn't
+        if(best < 0 || (covers && !bestcovers) ||
+                (covers == bestcovers && d < bestd)) {
+            best = i;
+            bestcovers = covers;
+            bestd = d;
+        }
+    }
+
+    return best < 0 ? RIGHT_ARM : best;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2017 iCub Facility, IIT
+ * Author: Arren.Glover@iit.it
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+ */
+
+#ifndef __ICUB_ARMTRACE_WORKSPACE__
+#define __ICUB_ARMTRACE_WORKSPACE__
+
+#include <yarp/sig/Vector.h>
+
+#define ARM_REACH           0.35    // [m]
+#define SHOULDER_Y          0.11    // [m]
+#define SHOULDER_Z          0.17    // [m]
+
+enum armside { RIGHT_ARM, LEFT_ARM, N_ARMS };
+
+//the cartesian controller part name of each arm
+const char *armPart(int side);
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM WORKSPACE
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//the reachable workspace of one arm in the robot root frame, approximated by
+//a sphere of radius ARM_REACH around the shoulder
+class vArmWorkspace
+{
+private:
+
+    double centre[3];
+    double reach;
+
+public:
+
+    vArmWorkspace();
+
+    void setSide(int side);
+    bool contains(const yarp::sig::Vector &x) const;
+    double distance(const yarp::sig::Vector &x) const;
+
+    //the point of the workspace closest to x
+    void nearest(const yarp::sig::Vector &x, yarp::sig::Vector &xn) const;
+
+};
+
+/*//////////////////////////////////////////////////////////////////////////////
+  ARM SELECTOR
+  ////////////////////////////////////////////////////////////////////////////*/
+
+//assigns a target to one of the enabled arms: the arm whose workspace covers
+//it (the nearer shoulder if both do) or, if none does, the nearest arm
+class vArmSelector
+{
+private:
+
+    vArmWorkspace workspace[N_ARMS];
+    bool enabled[N_ARMS];
+
+public:
+
+    vArmSelector();
+
+    void enable(int side, bool enable);
+    int select(const yarp::sig::Vector &x) const;
+
+};
+
+#endif